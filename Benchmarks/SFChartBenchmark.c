@@ -0,0 +1,296 @@
+//
+//  SFChartBenchmark.c
+//  SFKit
+//
+//  Created by David Moore on 10/17/26.
+//  Copyright © 2026 Moore Development. All rights reserved.
+//
+
+/*
+ Headless benchmark of the chart geometry and graph kernels over synthetic datasets.
+
+ Usage: sf-chart-benchmark [--points N] [--iterations N] [--filter SUBSTRING]
+
+ Every benchmark prints its name, the number of points, the median time per iteration and a checksum
+ of its output, which keeps the work from being optimized away and changes when the math does.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include "SFChartGeometry.h"
+#include "SFGraphChartKernels.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+typedef struct SFBenchmarkDataset {
+    long count;
+    double *values; // Random walk with runs of unset values
+    double *sortedValues; // Ascending timestamps with irregular intervals
+    double *scratch;
+    double *positions;
+    double *pieValues;
+    double *pieAngles;
+    SFChartGeometryPoint *pieCenters;
+    SFChartGeometrySize *pieLabelSizes;
+    long pieCount;
+} SFBenchmarkDataset;
+
+typedef double (*SFBenchmarkFunction)(SFBenchmarkDataset *dataset);
+
+typedef struct SFBenchmark {
+    const char *name;
+    SFBenchmarkFunction function;
+} SFBenchmark;
+
+// MARK: - Datasets
+
+// A fixed generator, so every platform benchmarks the same data
+static uint64_t SFBenchmarkRandomState = 0x853c49e6748fea9bULL;
+
+static double SFBenchmarkRandom(void) {
+    SFBenchmarkRandomState = SFBenchmarkRandomState * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (double)(SFBenchmarkRandomState >> 11) / (double)(1ULL << 53);
+}
+
+static void *SFBenchmarkAllocate(size_t size) {
+    void *memory = malloc(size > 0 ? size : 1);
+    if (memory == NULL) {
+        fprintf(stderr, "Unable to allocate %zu bytes\n", size);
+        exit(EXIT_FAILURE);
+    }
+    return memory;
+}
+
+static void SFBenchmarkDatasetInit(SFBenchmarkDataset *dataset, long count) {
+    dataset->count = count;
+    dataset->values = SFBenchmarkAllocate(count * sizeof(double));
+    dataset->sortedValues = SFBenchmarkAllocate(count * sizeof(double));
+    dataset->scratch = SFBenchmarkAllocate(count * sizeof(double));
+    dataset->positions = SFBenchmarkAllocate(count * sizeof(double));
+
+    double value = 0;
+    double timestamp = 0;
+    long unsetRun = 0;
+    for (long index = 0; index < count; index++) {
+        // Roughly one point in a hundred starts a short run of unset values
+        if (unsetRun == 0 && SFBenchmarkRandom() < 0.01) {
+            unsetRun = 1 + (long)(SFBenchmarkRandom() * 8);
+        }
+        value += SFBenchmarkRandom() - 0.5;
+        dataset->values[index] = (unsetRun > 0) ? SFGraphKernelUnsetValue : value;
+        unsetRun -= (unsetRun > 0);
+
+        timestamp += 0.5 + SFBenchmarkRandom() * 2;
+        dataset->sortedValues[index] = timestamp;
+    }
+
+    // Many thin segments make the label collisions dense
+    long pieCount = 24;
+    dataset->pieCount = pieCount;
+    dataset->pieValues = SFBenchmarkAllocate(pieCount * sizeof(double));
+    dataset->pieAngles = SFBenchmarkAllocate(pieCount * sizeof(double));
+    dataset->pieCenters = SFBenchmarkAllocate(pieCount * sizeof(SFChartGeometryPoint));
+    dataset->pieLabelSizes = SFBenchmarkAllocate(pieCount * sizeof(SFChartGeometrySize));
+    double sumOfValues = 0;
+    for (long index = 0; index < pieCount; index++) {
+        dataset->pieValues[index] = (index % 4 == 0) ? 20 + SFBenchmarkRandom() * 10 : 1 + SFBenchmarkRandom();
+        sumOfValues += dataset->pieValues[index];
+        dataset->pieLabelSizes[index] = (SFChartGeometrySize){32, 17};
+    }
+    for (long index = 0; index < pieCount; index++) {
+        dataset->pieValues[index] /= sumOfValues;
+    }
+}
+
+static void SFBenchmarkDatasetFree(SFBenchmarkDataset *dataset) {
+    free(dataset->values);
+    free(dataset->sortedValues);
+    free(dataset->scratch);
+    free(dataset->positions);
+    free(dataset->pieValues);
+    free(dataset->pieAngles);
+    free(dataset->pieCenters);
+    free(dataset->pieLabelSizes);
+}
+
+// MARK: - Benchmarks
+
+static const double SFBenchmarkCanvasWidth = 375;
+static const double SFBenchmarkCanvasHeight = 200;
+
+static double SFBenchmarkExtrema(SFBenchmarkDataset *dataset) {
+    return SFGraphKernelMinimum(dataset->values, dataset->count) + SFGraphKernelMaximum(dataset->values, dataset->count);
+}
+
+static double SFBenchmarkNormalization(SFBenchmarkDataset *dataset) {
+    double minimumValue = SFGraphKernelMinimum(dataset->values, dataset->count);
+    double maximumValue = SFGraphKernelMaximum(dataset->values, dataset->count);
+    SFGraphKernelMapToCanvas(dataset->values, dataset->scratch, dataset->count, minimumValue, maximumValue,
+                             SFBenchmarkCanvasHeight, SFBenchmarkCanvasHeight);
+    SFGraphKernelFloor(dataset->scratch, dataset->count);
+    return dataset->scratch[dataset->count / 2];
+}
+
+static double SFBenchmarkScalarNormalization(SFBenchmarkDataset *dataset) {
+    // The per-point path the kernels replace, kept as a reference doing the same work as "normalization"
+    double minimumValue = SFGraphKernelUnsetValue;
+    double maximumValue = -SFGraphKernelUnsetValue;
+    for (long index = 0; index < dataset->count; index++) {
+        double value = dataset->values[index];
+        if (value != SFGraphKernelUnsetValue) {
+            minimumValue = fmin(minimumValue, value);
+            maximumValue = fmax(maximumValue, value);
+        }
+    }
+    for (long index = 0; index < dataset->count; index++) {
+        double value = dataset->values[index];
+        double canvasValue = (value == SFGraphKernelUnsetValue) ? SFBenchmarkCanvasHeight
+                             : SFChartGeometryNormalizedCanvasValue(value, minimumValue, maximumValue, SFBenchmarkCanvasHeight);
+        dataset->scratch[index] = floor(canvasValue);
+    }
+    return dataset->scratch[dataset->count / 2];
+}
+
+static double SFBenchmarkStackSums(SFBenchmarkDataset *dataset) {
+    SFGraphKernelPrefixSum(dataset->sortedValues, dataset->scratch, dataset->count);
+    return dataset->scratch[dataset->count - 1];
+}
+
+static double SFBenchmarkXAxisPositions(SFBenchmarkDataset *dataset) {
+    // A zoomed in range, so most of the points lie past the canvas edges
+    SFChartGeometryXAxisPoints(dataset->positions, dataset->count, dataset->count / 4, dataset->count / 2,
+                               SFBenchmarkCanvasWidth);
+    return dataset->positions[dataset->count - 1];
+}
+
+static double SFBenchmarkTimeSeriesPositions(SFBenchmarkDataset *dataset) {
+    SFGraphKernelMapToCanvasX(dataset->sortedValues, dataset->positions, dataset->count, dataset->sortedValues[0],
+                              dataset->sortedValues[dataset->count - 1], SFBenchmarkCanvasWidth);
+    SFGraphKernelFloor(dataset->positions, dataset->count);
+    return dataset->positions[dataset->count / 2];
+}
+
+static double SFBenchmarkPlotOffsets(SFBenchmarkDataset *dataset) {
+    double checksum = 0;
+    for (long index = 0; index < dataset->count; index++) {
+        checksum += SFChartGeometryXOffsetForPlotIndex(index % 7, 7, 10);
+    }
+    return checksum;
+}
+
+static double SFBenchmarkInterpolation(SFBenchmarkDataset *dataset) {
+    // Scrubs across every segment of the plot
+    SFChartGeometryXAxisPoints(dataset->positions, dataset->count, 0, dataset->count, SFBenchmarkCanvasWidth);
+    double checksum = 0;
+    for (long index = 1; index < dataset->count; index++) {
+        double x1 = dataset->positions[index - 1];
+        double x2 = dataset->positions[index];
+        checksum += SFChartGeometryInterpolatedY(x1, dataset->sortedValues[index - 1], x2, dataset->sortedValues[index],
+                                                 (x1 + x2) / 2);
+    }
+    return checksum;
+}
+
+static double SFBenchmarkPieLabels(SFBenchmarkDataset *dataset) {
+    SFChartGeometrySize boundsSize = {SFBenchmarkCanvasWidth, SFBenchmarkCanvasWidth};
+    double pieRadius = 120;
+    SFChartGeometryPieSegmentAngles(dataset->pieValues, dataset->pieAngles, dataset->pieCount, 1);
+    for (long index = 0; index < dataset->pieCount; index++) {
+        dataset->pieCenters[index] = SFChartGeometryPieLabelCenter(dataset->pieAngles[index], pieRadius,
+                                                                   dataset->pieLabelSizes[index], boundsSize);
+    }
+    SFChartGeometryResolvePieLabelIntersections(dataset->pieAngles, dataset->pieCenters, dataset->pieLabelSizes,
+                                                dataset->pieCount, pieRadius, boundsSize, 1);
+    double checksum = 0;
+    for (long index = 0; index < dataset->pieCount; index++) {
+        checksum += dataset->pieAngles[index];
+    }
+    return checksum;
+}
+
+static const SFBenchmark SFBenchmarks[] = {
+    {"extrema", SFBenchmarkExtrema},
+    {"normalization", SFBenchmarkNormalization},
+    {"normalization-scalar", SFBenchmarkScalarNormalization},
+    {"stack-sums", SFBenchmarkStackSums},
+    {"x-axis-positions", SFBenchmarkXAxisPositions},
+    {"time-series-positions", SFBenchmarkTimeSeriesPositions},
+    {"plot-offsets", SFBenchmarkPlotOffsets},
+    {"interpolation", SFBenchmarkInterpolation},
+    {"pie-labels", SFBenchmarkPieLabels},
+};
+
+// MARK: - Running
+
+// Receives the result of every timed run, so the work cannot be optimized away
+static volatile double SFBenchmarkSink;
+
+static double SFBenchmarkNow(void) {
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + time.tv_nsec * 1e-9;
+}
+
+static int SFBenchmarkCompareDoubles(const void *a, const void *b) {
+    double difference = *(const double *)a - *(const double *)b;
+    return (difference > 0) - (difference < 0);
+}
+
+static long SFBenchmarkParseCount(const char *argument, const char *option) {
+    char *end = NULL;
+    long count = strtol(argument ? argument : "", &end, 10);
+    if (argument == NULL || *end != '\0' || count < 2) {
+        fprintf(stderr, "%s expects a count of at least 2\n", option);
+        exit(EXIT_FAILURE);
+    }
+    return count;
+}
+
+int main(int argc, const char *argv[]) {
+    long count = 100000;
+    long iterations = 50;
+    const char *filter = NULL;
+    for (int index = 1; index < argc; index++) {
+        if (strcmp(argv[index], "--points") == 0) {
+            count = SFBenchmarkParseCount(index + 1 < argc ? argv[++index] : NULL, "--points");
+        } else if (strcmp(argv[index], "--iterations") == 0) {
+            iterations = SFBenchmarkParseCount(index + 1 < argc ? argv[++index] : NULL, "--iterations");
+        } else if (strcmp(argv[index], "--filter") == 0 && index + 1 < argc) {
+            filter = argv[++index];
+        } else {
+            fprintf(stderr, "Usage: %s [--points N] [--iterations N] [--filter SUBSTRING]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    SFBenchmarkDataset dataset;
+    SFBenchmarkDatasetInit(&dataset, count);
+    double *durations = SFBenchmarkAllocate(iterations * sizeof(double));
+
+    printf("%-24s %10s %14s %20s\n", "benchmark", "points", "median (us)", "checksum");
+    for (size_t benchmarkIndex = 0; benchmarkIndex < sizeof(SFBenchmarks) / sizeof(SFBenchmarks[0]); benchmarkIndex++) {
+        const SFBenchmark *benchmark = &SFBenchmarks[benchmarkIndex];
+        if (filter && strstr(benchmark->name, filter) == NULL) {
+            continue;
+        }
+
+        // The first run warms the caches and provides the checksum
+        double checksum = benchmark->function(&dataset);
+        for (long iteration = 0; iteration < iterations; iteration++) {
+            double startTime = SFBenchmarkNow();
+            SFBenchmarkSink = benchmark->function(&dataset);
+            durations[iteration] = SFBenchmarkNow() - startTime;
+        }
+        qsort(durations, iterations, sizeof(double), SFBenchmarkCompareDoubles);
+        printf("%-24s %10ld %14.3f %20.6g\n", benchmark->name, count, durations[iterations / 2] * 1e6, checksum);
+    }
+
+    free(durations);
+    SFBenchmarkDatasetFree(&dataset);
+    return EXIT_SUCCESS;
+}
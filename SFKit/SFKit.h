@@ -25,7 +25,9 @@ FOUNDATION_EXPORT const unsigned char SFKitVersionString[];
 #import <SFKit/UIView+SFAppearanceEnvironment.h>
 
 #import <SFKit/SFChartTypes.h>
+#import <SFKit/SFChartPerformanceObserver.h>
 #import <SFKit/SFBarGraphChartView.h>
 #import <SFKit/SFDiscreteGraphChartView.h>
 #import <SFKit/SFLineGraphChartView.h>
+#import <SFKit/SFTimeSeriesGraphChartView.h>
 #import <SFKit/SFPieChartView.h>
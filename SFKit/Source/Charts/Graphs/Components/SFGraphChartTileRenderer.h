@@ -0,0 +1,81 @@
+//
+//  SFGraphChartTileRenderer.h
+//  SFKit
+//
+//  Created by David Moore on 10/17/26.
+//  Copyright © 2026 Moore Development. All rights reserved.
+//
+
+@import UIKit;
+#import <SFKit/SFDefines.h>
+#import "SFChartGeometry.h"
+#import "SFHelpers_Private.h"
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ The mapping from the points of a plot to the content space of the tiles, captured when the tiles are
+ invalidated so they can be drawn off the main thread. Content x-coordinates do not depend on the
+ visible range, so panning translates the tiles instead of redrawing them.
+ */
+typedef struct SFGraphChartTileGeometry {
+    double minimumValue;
+    double maximumValue;
+    CGFloat canvasHeight;
+    CGFloat xAxisPointWidth; // Distance between x-axis points, unless the points have explicit positions
+    const CGFloat *_Nullable xPositions; // Explicit content x-coordinate of every point, or NULL
+    NSInteger numberOfPoints;
+    CGFloat xOffset;
+    CGFloat pointMargin; // Horizontal distance a point draws past its x-coordinate, e.g. half a bar
+} SFGraphChartTileGeometry;
+
+SF_INLINE CGFloat SFGraphChartTileXPosition(const SFGraphChartTileGeometry *geometry, NSInteger pointIndex) {
+    CGFloat xPosition = geometry->xPositions ? geometry->xPositions[pointIndex] : floor(geometry->xAxisPointWidth * pointIndex);
+    return xPosition + geometry->xOffset;
+}
+
+SF_INLINE CGFloat SFGraphChartTileYPosition(const SFGraphChartTileGeometry *geometry, double value) {
+    return floor(SFChartGeometryNormalizedCanvasValue(value, geometry->minimumValue, geometry->maximumValue, geometry->canvasHeight));
+}
+
+/// The points which draw into the content x-range, including the neighbors the lines from the range lead to.
+SF_EXTERN NSRange SFGraphChartTilePointRange(const SFGraphChartTileGeometry *geometry, CGFloat minimumX, CGFloat maximumX);
+
+/**
+ Draws the content of a tile into `context`, whose coordinates are content coordinates clipped to
+ `rect`. Called on a background queue, so it may only read immutable snapshots of the plots.
+ */
+typedef void (^SFGraphChartTileDrawingBlock)(CGContextRef context, CGRect rect);
+
+/**
+ Draws plots into bitmap tiles on a serial background queue and shows them as the contents of the
+ tile layers. Only the tiles around the visible part of the content are kept; tiles which scroll into
+ view are drawn as they appear, and invalidated tiles keep their previous contents until they are
+ redrawn.
+ */
+@interface SFGraphChartTileRenderer : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/// Creates a renderer whose tiles are added to `hostLayer`.
+- (instancetype)initWithHostLayer:(CALayer *)hostLayer NS_DESIGNATED_INITIALIZER;
+
+/// Draws the content of every tile. Setting this property invalidates every tile.
+@property (nonatomic, copy, nullable) SFGraphChartTileDrawingBlock drawingBlock;
+
+/// Marks every tile for redrawing on the next layout.
+- (void)invalidateAllTiles;
+
+/**
+ Translates the tiles so `contentOffset` lies on the left edge of the host layer, and draws the tiles
+ which come into view. Tiles are only kept over the `[0, contentWidth]` content range.
+ */
+- (void)layoutTilesWithContentOffset:(CGFloat)contentOffset visibleSize:(CGSize)visibleSize contentWidth:(CGFloat)contentWidth;
+
+/// Removes the tiles from the host layer and drops the tiles being drawn; the next layout adds them again.
+- (void)removeAllTiles;
+
+@end
+
+NS_ASSUME_NONNULL_END
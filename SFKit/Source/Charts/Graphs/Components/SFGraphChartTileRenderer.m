@@ -0,0 +1,247 @@
+//
+//  SFGraphChartTileRenderer.m
+//  SFKit
+//
+//  Created by David Moore on 10/17/26.
+//  Copyright © 2026 Moore Development. All rights reserved.
+//
+
+#import "SFGraphChartTileRenderer.h"
+
+#import <stdatomic.h>
+
+
+static const CGFloat TileWidth = 256.0;
+static const CGFloat TileOutset = 8.0; // Drawn above and below the visible height, so strokes along the edges are not cut off
+static const NSInteger NumberOfPrefetchedTiles = 1; // Tiles drawn past each side of the visible ones
+static const CGFloat ContentMargin = 16.0; // Drawn past each end of the content, e.g. by the bars centered on the first and last points
+
+NSRange SFGraphChartTilePointRange(const SFGraphChartTileGeometry *geometry, CGFloat minimumX, CGFloat maximumX) {
+    NSInteger numberOfPoints = geometry->numberOfPoints;
+    if (numberOfPoints <= 0) {
+        return NSMakeRange(0, 0);
+    }
+    minimumX -= geometry->xOffset + geometry->pointMargin;
+    maximumX += geometry->pointMargin - geometry->xOffset;
+
+    NSInteger startIndex = 0;
+    NSInteger endIndex = numberOfPoints;
+    if (geometry->xPositions) {
+        // The explicit positions are sorted
+        NSInteger low = 0;
+        NSInteger high = numberOfPoints;
+        while (low < high) {
+            NSInteger middle = low + (high - low) / 2;
+            if (geometry->xPositions[middle] < minimumX) {
+                low = middle + 1;
+            } else {
+                high = middle;
+            }
+        }
+        startIndex = low;
+        high = numberOfPoints;
+        while (low < high) {
+            NSInteger middle = low + (high - low) / 2;
+            if (geometry->xPositions[middle] <= maximumX) {
+                low = middle + 1;
+            } else {
+                high = middle;
+            }
+        }
+        endIndex = low;
+    } else if (geometry->xAxisPointWidth > 0) {
+        startIndex = (NSInteger)MAX(floor(minimumX / geometry->xAxisPointWidth), -1.0);
+        endIndex = (NSInteger)MIN(ceil(maximumX / geometry->xAxisPointWidth) + 1, (double)numberOfPoints);
+    }
+
+    // Lines leave the range towards the neighbors on each side
+    startIndex = MIN(MAX(startIndex - 1, 0), numberOfPoints);
+    endIndex = MIN(MAX(endIndex + 1, startIndex), numberOfPoints);
+    return NSMakeRange(startIndex, endIndex - startIndex);
+}
+
+static CGImageRef SFGraphChartTileCreateImage(SFGraphChartTileDrawingBlock drawingBlock, CGRect rect, CGFloat scale) {
+    size_t width = (size_t)ceil(CGRectGetWidth(rect) * scale);
+    size_t height = (size_t)ceil(CGRectGetHeight(rect) * scale);
+    CGColorSpaceRef colorSpace = CGColorSpaceCreateWithName(kCGColorSpaceSRGB);
+    CGContextRef context = CGBitmapContextCreate(NULL, width, height, 8, 0, colorSpace,
+                                                 kCGImageAlphaPremultipliedFirst | kCGBitmapByteOrder32Host);
+    CGColorSpaceRelease(colorSpace);
+    if (context == NULL) {
+        return NULL;
+    }
+
+    // Flip to the top left origin of UIKit, with the tile at the origin of the bitmap
+    CGContextScaleCTM(context, scale, -scale);
+    CGContextTranslateCTM(context, -CGRectGetMinX(rect), -CGRectGetMaxY(rect));
+    CGContextClipToRect(context, rect);
+    drawingBlock(context, rect);
+
+    CGImageRef image = CGBitmapContextCreateImage(context);
+    CGContextRelease(context);
+    return image;
+}
+
+
+// The drawing block of a generation of tiles, cancelled once the tiles are invalidated
+@interface SFGraphChartTileScene : NSObject {
+    @public
+    atomic_bool _cancelled;
+}
+
+@property (nonatomic, copy, readonly, nullable) SFGraphChartTileDrawingBlock drawingBlock;
+
+@end
+
+
+@implementation SFGraphChartTileScene
+
+- (instancetype)initWithDrawingBlock:(SFGraphChartTileDrawingBlock)drawingBlock {
+    if (self = [super init]) {
+        _drawingBlock = [drawingBlock copy];
+        atomic_init(&_cancelled, false);
+    }
+    return self;
+}
+
+@end
+
+
+@interface SFGraphChartTile : NSObject
+
+@property (nonatomic) CALayer *layer;
+
+@property (nonatomic, nullable) SFGraphChartTileScene *scene; // Scene shown or being drawn by the tile
+
+@end
+
+
+@implementation SFGraphChartTile
+
+@end
+
+
+@implementation SFGraphChartTileRenderer {
+    __weak CALayer *_hostLayer;
+    CALayer *_contentLayer; // Translated by the content offset
+    dispatch_queue_t _drawingQueue;
+    NSMutableDictionary<NSNumber *, SFGraphChartTile *> *_tiles;
+    SFGraphChartTileScene *_scene;
+    CGFloat _tileHeight;
+    CGFloat _tileScale;
+}
+
+- (instancetype)initWithHostLayer:(CALayer *)hostLayer {
+    if (self = [super init]) {
+        _hostLayer = hostLayer;
+        _contentLayer = [CALayer layer];
+        _contentLayer.anchorPoint = CGPointZero;
+        _drawingQueue = dispatch_queue_create("ca.mooredev.SFKit.GraphChartTiles",
+                                              dispatch_queue_attr_make_with_qos_class(DISPATCH_QUEUE_SERIAL, QOS_CLASS_USER_INITIATED, 0));
+        _tiles = [NSMutableDictionary new];
+        _scene = [[SFGraphChartTileScene alloc] initWithDrawingBlock:nil];
+    }
+    return self;
+}
+
+- (void)dealloc {
+    atomic_store(&_scene->_cancelled, true);
+}
+
+- (void)setDrawingBlock:(SFGraphChartTileDrawingBlock)drawingBlock {
+    _drawingBlock = [drawingBlock copy];
+    [self invalidateAllTiles];
+}
+
+- (void)invalidateAllTiles {
+    // Tiles already drawn keep their contents until the new scene is drawn
+    atomic_store(&_scene->_cancelled, true);
+    _scene = [[SFGraphChartTileScene alloc] initWithDrawingBlock:_drawingBlock];
+}
+
+- (void)layoutTilesWithContentOffset:(CGFloat)contentOffset visibleSize:(CGSize)visibleSize contentWidth:(CGFloat)contentWidth {
+    CGFloat scale = [UIScreen mainScreen].scale;
+    if (visibleSize.height != _tileHeight || scale != _tileScale) {
+        _tileHeight = visibleSize.height;
+        _tileScale = scale;
+        [self invalidateAllTiles];
+    }
+
+    [CATransaction begin];
+    [CATransaction setDisableActions:YES];
+    if (_contentLayer.superlayer != _hostLayer) {
+        [_hostLayer insertSublayer:_contentLayer atIndex:0];
+    }
+    _contentLayer.position = CGPointMake(-contentOffset, 0);
+
+    // Prefetching stops at the ends of the content, where the tiles would be empty
+    NSInteger firstTileIndex = MAX((NSInteger)floor(contentOffset / TileWidth) - NumberOfPrefetchedTiles,
+                                   (NSInteger)floor(-ContentMargin / TileWidth));
+    NSInteger lastTileIndex = MIN((NSInteger)floor((contentOffset + visibleSize.width) / TileWidth) + NumberOfPrefetchedTiles,
+                                  (NSInteger)floor((contentWidth + ContentMargin) / TileWidth));
+    for (NSNumber *tileIndex in _tiles.allKeys) {
+        if (tileIndex.integerValue < firstTileIndex || tileIndex.integerValue > lastTileIndex) {
+            // Only the tiles around the visible ones are kept, so the memory used by the tiles stays bounded
+            [_tiles[tileIndex].layer removeFromSuperlayer];
+            [_tiles removeObjectForKey:tileIndex];
+        }
+    }
+
+    for (NSInteger tileIndex = firstTileIndex; tileIndex <= lastTileIndex; tileIndex++) {
+        SFGraphChartTile *tile = _tiles[@(tileIndex)];
+        if (!tile) {
+            tile = [SFGraphChartTile new];
+            tile.layer = [CALayer layer];
+            [_contentLayer addSublayer:tile.layer];
+            _tiles[@(tileIndex)] = tile;
+        }
+        tile.layer.frame = CGRectMake(tileIndex * TileWidth, -TileOutset, TileWidth, _tileHeight + 2 * TileOutset);
+        tile.layer.contentsScale = _tileScale;
+        if (tile.scene != _scene) {
+            [self drawTile:tile atIndex:tileIndex];
+        }
+    }
+    [CATransaction commit];
+}
+
+- (void)drawTile:(SFGraphChartTile *)tile atIndex:(NSInteger)tileIndex {
+    SFGraphChartTileScene *scene = _scene;
+    tile.scene = scene;
+    SFGraphChartTileDrawingBlock drawingBlock = scene.drawingBlock;
+    if (!drawingBlock) {
+        tile.layer.contents = nil;
+        return;
+    }
+
+    CGRect rect = tile.layer.frame;
+    CGFloat scale = _tileScale;
+    __weak SFGraphChartTileRenderer *weakSelf = self;
+    dispatch_async(_drawingQueue, ^{
+        // Tiles of an invalidated scene are skipped rather than drawn
+        CGImageRef image = NULL;
+        if (!atomic_load(&scene->_cancelled)) {
+            image = SFGraphChartTileCreateImage(drawingBlock, rect, scale);
+        }
+        dispatch_async(dispatch_get_main_queue(), ^{
+            SFGraphChartTileRenderer *strongSelf = weakSelf;
+            if (strongSelf && image && tile.scene == scene && strongSelf->_tiles[@(tileIndex)] == tile) {
+                [CATransaction begin];
+                [CATransaction setDisableActions:YES];
+                tile.layer.contents = (__bridge id)image;
+                [CATransaction commit];
+            }
+            CGImageRelease(image);
+        });
+    });
+}
+
+- (void)removeAllTiles {
+    [self invalidateAllTiles];
+    for (SFGraphChartTile *tile in _tiles.allValues) {
+        [tile.layer removeFromSuperlayer];
+    }
+    [_tiles removeAllObjects];
+    [_contentLayer removeFromSuperlayer];
+}
+
+@end
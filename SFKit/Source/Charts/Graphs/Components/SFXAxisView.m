@@ -45,6 +45,7 @@ static const CGFloat LastLabelHeight = 20.0;
     CALayer *_lineLayer;
     NSMutableArray<UILabel *> *_titleLabels;
     NSMutableArray<CALayer *> *_titleTickLayers;
+    NSArray<NSLayoutConstraint *> *_titleLabelConstraints;
 }
 
 - (instancetype)initWithFrame:(CGRect)frame {
@@ -67,6 +68,9 @@ static const CGFloat LastLabelHeight = 20.0;
         _lineLayer = [CALayer layer];
         _lineLayer.backgroundColor = _axisColor.CGColor;
         [self.layer addSublayer:_lineLayer];
+        
+        _titleLabels = [NSMutableArray new];
+        _titleTickLayers = [NSMutableArray new];
     }
     return self;
 }
@@ -86,6 +90,7 @@ static const CGFloat LastLabelHeight = 20.0;
 }
 
 - (void)setUpConstraints {
+    [NSLayoutConstraint deactivateConstraints:_titleLabelConstraints];
     NSMutableArray<NSLayoutConstraint *> *constraints = [NSMutableArray new];
     
     NSUInteger numberOfTitleLabels = _titleLabels.count;
@@ -145,54 +150,67 @@ static const CGFloat LastLabelHeight = 20.0;
         }
     }
     [NSLayoutConstraint activateConstraints:constraints];
+    _titleLabelConstraints = constraints;
 }
 
 - (void)updateTitles {
-    [_titleLabels makeObjectsPerformSelector:@selector(removeFromSuperview)]; // Old constraints automatically removed when removing the views
-    [_titleTickLayers makeObjectsPerformSelector:@selector(removeFromSuperlayer)];
-    _titleLabels = nil;
-    _titleTickLayers = nil;
-    
+    // Only the visible x-axis points are titled
+    NSRange visibleRange = [_parentGraphChartView visibleXAxisPointRange];
+    NSInteger numberOfTitleLabels = 0;
     if ([_parentGraphChartView.dataSource respondsToSelector:@selector(graphChartView:titleForXAxisAtPointIndex:)]) {
-        _titleLabels = [NSMutableArray new];
-        _titleTickLayers = [NSMutableArray new];
-
-        NSInteger numberOfTitleLabels = _parentGraphChartView.numberOfXAxisPoints;
-        for (NSInteger i = 0; i < numberOfTitleLabels; i++) {
-            NSString *title = [_parentGraphChartView.dataSource graphChartView:_parentGraphChartView titleForXAxisAtPointIndex:i];
-            UILabel *label = [UILabel new];
-            label.text = title;
-            label.font = _titleFont;
-            label.numberOfLines = 2;
-            label.textAlignment = NSTextAlignmentCenter;
-            label.adjustsFontSizeToFitWidth = YES;
-            label.minimumScaleFactor = 0.7;
-            label.translatesAutoresizingMaskIntoConstraints = NO;
-            
-            if (i < (numberOfTitleLabels - 1)) {
-                label.textColor = self.tintColor;
-            } else {
-                label.textColor = [UIColor whiteColor];
-                label.backgroundColor = self.tintColor;
-                label.layer.cornerRadius = LastLabelHeight * 0.5;
-                label.layer.masksToBounds = YES;
-            }
-            
-            [self addSubview:label];
-            [_titleLabels addObject:label];
-        }
+        numberOfTitleLabels = visibleRange.length;
+    }
+    
+    // Reuse the existing labels and tick layers, only adding or removing the difference
+    NSInteger numberOfReusedTitleLabels = MIN(numberOfTitleLabels, (NSInteger)_titleLabels.count);
+    BOOL titleLabelCountChanged = (numberOfTitleLabels != _titleLabels.count);
+    if (_titleLabels.count > numberOfTitleLabels) {
+        NSRange surplusRange = NSMakeRange(numberOfTitleLabels, _titleLabels.count - numberOfTitleLabels);
+        [[_titleLabels subarrayWithRange:surplusRange] makeObjectsPerformSelector:@selector(removeFromSuperview)]; // Old constraints automatically removed when removing the views
+        [[_titleTickLayers subarrayWithRange:surplusRange] makeObjectsPerformSelector:@selector(removeFromSuperlayer)];
+        [_titleLabels removeObjectsInRange:surplusRange];
+        [_titleTickLayers removeObjectsInRange:surplusRange];
+    }
+    for (NSInteger i = numberOfReusedTitleLabels; i < numberOfTitleLabels; i++) {
+        UILabel *label = [UILabel new];
+        label.numberOfLines = 2;
+        label.textAlignment = NSTextAlignmentCenter;
+        label.adjustsFontSizeToFitWidth = YES;
+        label.minimumScaleFactor = 0.7;
+        label.translatesAutoresizingMaskIntoConstraints = NO;
+        [self addSubview:label];
+        [_titleLabels addObject:label];
         
         // Add vertical tick layers above labels
-        for (NSInteger i = 0; i < numberOfTitleLabels; i++) {
-            CALayer *titleTickLayer = [CALayer layer];
-            CGFloat positionOnXAxis = xAxisPoint(i, numberOfTitleLabels, self.bounds.size.width);
-            titleTickLayer.frame = CGRectMake(positionOnXAxis - 0.5, -SFGraphChartViewAxisTickLength, 1, SFGraphChartViewAxisTickLength);
-            titleTickLayer.backgroundColor = _axisColor.CGColor;
-
-            [self.layer addSublayer:titleTickLayer];
-            [_titleTickLayers addObject:titleTickLayer];
+        CALayer *titleTickLayer = [CALayer layer];
+        [self.layer addSublayer:titleTickLayer];
+        [_titleTickLayers addObject:titleTickLayer];
+    }
+    
+    for (NSInteger i = 0; i < numberOfTitleLabels; i++) {
+        UILabel *label = _titleLabels[i];
+        label.text = [_parentGraphChartView.dataSource graphChartView:_parentGraphChartView titleForXAxisAtPointIndex:visibleRange.location + i];
+        label.font = _titleFont;
+        if (i < (numberOfTitleLabels - 1)) {
+            label.textColor = self.tintColor;
+            label.backgroundColor = nil;
+            label.layer.cornerRadius = 0;
+            label.layer.masksToBounds = NO;
+        } else {
+            label.textColor = [UIColor whiteColor];
+            label.backgroundColor = self.tintColor;
+            label.layer.cornerRadius = LastLabelHeight * 0.5;
+            label.layer.masksToBounds = YES;
         }
-
+        
+        CALayer *titleTickLayer = _titleTickLayers[i];
+        CGFloat positionOnXAxis = xAxisPoint(i, numberOfTitleLabels, self.bounds.size.width);
+        titleTickLayer.frame = CGRectMake(positionOnXAxis - 0.5, -SFGraphChartViewAxisTickLength, 1, SFGraphChartViewAxisTickLength);
+        titleTickLayer.backgroundColor = _axisColor.CGColor;
+    }
+    
+    if (titleLabelCountChanged) {
+        // The label positions only depend on the number of labels
         [self setUpConstraints];
     }
 }
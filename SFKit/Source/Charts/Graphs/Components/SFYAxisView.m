@@ -67,6 +67,8 @@ static const CGFloat ImageVerticalPadding = 3.0;
         _parentGraphChartView = parentGraphChartView;
         _axisColor = _parentGraphChartView.axisColor;
         _titleColor = _parentGraphChartView.verticalAxisTitleColor;
+        _tickLayersByFactor = [NSMutableDictionary new];
+        _tickLabelsByFactor = [NSMutableDictionary new];
         [self setDecimalPlaces:0];
     }
     return self;
@@ -78,88 +80,111 @@ static const CGFloat ImageVerticalPadding = 3.0;
 }
 
 - (void)updateTicksAndLabels {
-    [_maxImageView removeFromSuperview];
-    _maxImageView = nil;
-    [_minImageView removeFromSuperview];
-    _minImageView = nil;
-    
-    [_tickLayersByFactor.allValues makeObjectsPerformSelector:@selector(removeFromSuperlayer)];
-    [_tickLabelsByFactor.allValues makeObjectsPerformSelector:@selector(removeFromSuperview)];
-    _tickLayersByFactor = nil;
-    _tickLabelsByFactor = nil;
-    
     CGRect bounds = self.bounds;
     CGFloat width = bounds.size.width;
+    NSArray *yAxisLabelFactors = @[];
     if (_parentGraphChartView.maximumValueImage && _parentGraphChartView.minimumValueImage) {
         // Use image icons as legends
         CGFloat halfWidth = width / 2;
         
-        _maxImageView = [[UIImageView alloc] initWithImage:_parentGraphChartView.maximumValueImage];
-        _maxImageView.contentMode = UIViewContentModeScaleAspectFit;
+        if (!_maxImageView) {
+            _maxImageView = [UIImageView new];
+            _maxImageView.contentMode = UIViewContentModeScaleAspectFit;
+            [self addSubview:_maxImageView];
+        }
+        _maxImageView.image = _parentGraphChartView.maximumValueImage;
         _maxImageView.frame = CGRectMake(width - halfWidth,
                                          -halfWidth / 2,
                                          halfWidth,
                                          halfWidth);
-        [self addSubview:_maxImageView];
         
-        _minImageView = [[UIImageView alloc] initWithImage:_parentGraphChartView.minimumValueImage];
-        _minImageView.contentMode = UIViewContentModeScaleAspectFit;
+        if (!_minImageView) {
+            _minImageView = [UIImageView new];
+            _minImageView.contentMode = UIViewContentModeScaleAspectFit;
+            [self addSubview:_minImageView];
+        }
+        _minImageView.image = _parentGraphChartView.minimumValueImage;
         _minImageView.frame = CGRectMake(width - halfWidth,
                                         CGRectGetMaxY(bounds) - halfWidth - ImageVerticalPadding,
                                         halfWidth,
                                         halfWidth);
-        [self addSubview:_minImageView];
         
     } else {
-        _tickLayersByFactor = [NSMutableDictionary new];
-        _tickLabelsByFactor = [NSMutableDictionary new];
+        [_maxImageView removeFromSuperview];
+        _maxImageView = nil;
+        [_minImageView removeFromSuperview];
+        _minImageView = nil;
         
-        NSArray *yAxisLabelFactors = nil;
-        CGFloat minimumValue = _parentGraphChartView.minimumValue;
-        CGFloat maximumValue = _parentGraphChartView.maximumValue;
-        if (minimumValue == maximumValue) {
+        if (_parentGraphChartView.minimumValue == _parentGraphChartView.maximumValue) {
             yAxisLabelFactors = @[ @0.5f ];
         } else {
             yAxisLabelFactors = @[ @0.2f, @1.0f ];
         }
-        
-        for (NSNumber *factorNumber in yAxisLabelFactors) {
-            
-            CGFloat factor = factorNumber.floatValue;
-            
-            CALayer *tickLayer = [CALayer layer];
-            CGFloat tickYPosition = CGRectGetHeight(self.bounds) * (1 - factor);
-            CGFloat tickXOrigin = CGRectGetWidth(self.bounds) - SFGraphChartViewAxisTickLength;
-            tickLayer.frame = CGRectMake(tickXOrigin,
-                                         tickYPosition - 0.5,
-                                         SFGraphChartViewAxisTickLength,
-                                         1);
-            tickLayer.backgroundColor = _parentGraphChartView.axisColor.CGColor;
-
-            [self.layer addSublayer:tickLayer];
-            _tickLayersByFactor[factorNumber] = tickLayer;
-            
-            CGFloat labelHeight = 20;
-            CGFloat labelYPosition = tickYPosition - labelHeight / 2;
-            UILabel *tickLabel = [[UILabel alloc] initWithFrame:CGRectMake(0,
-                                                                           labelYPosition,
-                                                                           width - (SFGraphChartViewAxisTickLength + SFGraphChartViewYAxisTickPadding),
-                                                                           labelHeight)];
-            
-            CGFloat yValue = minimumValue + (maximumValue - minimumValue) * factor;
-            if (yValue != 0) {
-                tickLabel.text = [NSString stringWithFormat:_decimalFormat, yValue];
+    }
+    
+    // Reuse the ticks and labels of factors which are no longer shown for the new factors, only
+    // adding or removing the difference
+    NSMutableArray<CALayer *> *reusableTickLayers = [NSMutableArray new];
+    NSMutableArray<UILabel *> *reusableTickLabels = [NSMutableArray new];
+    for (NSNumber *factorNumber in _tickLayersByFactor.allKeys) {
+        if (![yAxisLabelFactors containsObject:factorNumber]) {
+            [reusableTickLayers addObject:_tickLayersByFactor[factorNumber]];
+            [reusableTickLabels addObject:_tickLabelsByFactor[factorNumber]];
+            [_tickLayersByFactor removeObjectForKey:factorNumber];
+            [_tickLabelsByFactor removeObjectForKey:factorNumber];
+        }
+    }
+    
+    CGFloat minimumValue = _parentGraphChartView.minimumValue;
+    CGFloat maximumValue = _parentGraphChartView.maximumValue;
+    for (NSNumber *factorNumber in yAxisLabelFactors) {
+        CALayer *tickLayer = _tickLayersByFactor[factorNumber];
+        UILabel *tickLabel = _tickLabelsByFactor[factorNumber];
+        if (!tickLayer) {
+            tickLayer = reusableTickLayers.lastObject;
+            tickLabel = reusableTickLabels.lastObject;
+            if (tickLayer) {
+                [reusableTickLayers removeLastObject];
+                [reusableTickLabels removeLastObject];
+            } else {
+                tickLayer = [CALayer layer];
+                [self.layer addSublayer:tickLayer];
+                
+                tickLabel = [UILabel new];
+                tickLabel.backgroundColor = [UIColor clearColor];
+                tickLabel.textAlignment = NSTextAlignmentRight;
+                tickLabel.minimumScaleFactor = 0.8;
+                [self addSubview:tickLabel];
             }
-            tickLabel.backgroundColor = [UIColor clearColor];
-            tickLabel.textColor = _titleColor;
-            tickLabel.textAlignment = NSTextAlignmentRight;
-            tickLabel.font = _titleFont;
-            tickLabel.minimumScaleFactor = 0.8;
-            [tickLabel sizeToFit];
-            [self addSubview:tickLabel];
+            _tickLayersByFactor[factorNumber] = tickLayer;
             _tickLabelsByFactor[factorNumber] = tickLabel;
         }
+        
+        CGFloat factor = factorNumber.floatValue;
+        CGFloat tickYPosition = CGRectGetHeight(self.bounds) * (1 - factor);
+        CGFloat tickXOrigin = CGRectGetWidth(self.bounds) - SFGraphChartViewAxisTickLength;
+        tickLayer.frame = CGRectMake(tickXOrigin,
+                                     tickYPosition - 0.5,
+                                     SFGraphChartViewAxisTickLength,
+                                     1);
+        tickLayer.backgroundColor = _parentGraphChartView.axisColor.CGColor;
+        
+        CGFloat labelHeight = 20;
+        CGFloat labelYPosition = tickYPosition - labelHeight / 2;
+        tickLabel.frame = CGRectMake(0,
+                                     labelYPosition,
+                                     width - (SFGraphChartViewAxisTickLength + SFGraphChartViewYAxisTickPadding),
+                                     labelHeight);
+        
+        CGFloat yValue = minimumValue + (maximumValue - minimumValue) * factor;
+        tickLabel.text = (yValue != 0) ? [NSString stringWithFormat:_decimalFormat, yValue] : nil;
+        tickLabel.textColor = _titleColor;
+        tickLabel.font = _titleFont;
+        [tickLabel sizeToFit];
     }
+    
+    [reusableTickLayers makeObjectsPerformSelector:@selector(removeFromSuperlayer)];
+    [reusableTickLabels makeObjectsPerformSelector:@selector(removeFromSuperview)];
 }
 
 - (void)layoutTicksAndLabels {
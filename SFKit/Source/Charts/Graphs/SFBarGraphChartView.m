@@ -93,20 +93,9 @@
 static const CGFloat BarWidth = 10.0;
 
 
-@interface SFBarGraphChartView ()
-
-@property (nonatomic) NSMutableArray<NSMutableArray<SFValueStack *> *> *dataPoints; // Actual data
-
-@property (nonatomic) NSMutableArray<NSMutableArray<SFValueStack *> *> *yAxisPoints; // Normalized for the plot view height
-
-@end
-
-
 @implementation SFBarGraphChartView
 
 @dynamic dataSource;
-@dynamic dataPoints;
-@dynamic yAxisPoints;
 
 #pragma mark - Draw
 
@@ -114,157 +103,262 @@ static const CGFloat BarWidth = 10.0;
     return [self.dataSource graphChartView:self dataPointForPointIndex:pointIndex plotIndex:plotIndex];
 }
 
-- (SFValueStack *)dummyPoint {
-    return [SFValueStack new];
+- (void)appendDataPointForPointIndex:(NSInteger)pointIndex plotIndex:(NSInteger)plotIndex toPlotBuffer:(SFGraphChartPlotBuffer *)plotBuffer {
+    [plotBuffer appendValueStack:[self dataPointForPointIndex:pointIndex plotIndex:plotIndex]];
+}
+
+- (void)replaceDataPointForPointIndex:(NSInteger)pointIndex plotIndex:(NSInteger)plotIndex inPlotBuffer:(SFGraphChartPlotBuffer *)plotBuffer {
+    [plotBuffer setValueStack:[self dataPointForPointIndex:pointIndex plotIndex:plotIndex] atIndex:pointIndex];
+}
+
+- (SFValueStack *)storedDataPointForPointIndex:(NSInteger)pointIndex plotIndex:(NSInteger)plotIndex {
+    SFGraphChartPlotBuffer *plotBuffer = self.plotBuffers[plotIndex];
+    NSInteger numberOfStackedValues = [plotBuffer numberOfStackedValuesAtIndex:pointIndex];
+    if (numberOfStackedValues == 0) {
+        return [SFValueStack new];
+    }
+    
+    NSMutableArray<NSNumber *> *stackedValues = [NSMutableArray arrayWithCapacity:numberOfStackedValues];
+    const double *pointStackValues = plotBuffer.stackValues + plotBuffer.stackOffsets[pointIndex];
+    for (NSInteger index = 0; index < numberOfStackedValues; index++) {
+        [stackedValues addObject:@(pointStackValues[index])];
+    }
+    return [[SFValueStack alloc] initWithStackedValues:stackedValues];
 }
 
 - (BOOL)shouldDrawLinesForPlotIndex:(NSInteger)plotIndex {
     return YES;
 }
 
-- (NSMutableArray<SFValueStack *> *)normalizedCanvasDataPointsForPlotIndex:(NSInteger)plotIndex canvasHeight:(CGFloat)viewHeight {
-    NSMutableArray<SFValueStack *> *normalizedDataPoints = [NSMutableArray new];
-    
-    if (plotIndex < self.dataPoints.count) {
-        NSUInteger pointCount = self.dataPoints[plotIndex].count;
-        for (NSUInteger pointIndex = 0; pointIndex < pointCount; pointIndex++) {
-            
-            NSMutableArray *normalizedDoubleStackValues = [NSMutableArray new];
-            SFValueStack *dataPointValue = self.dataPoints[plotIndex][pointIndex];
-            
-            if (!dataPointValue.isUnset) {
-                double range = self.maximumValue - self.minimumValue;
-                double sum = 0;
-                for (NSNumber *value in dataPointValue.stackedValues) {
-                    // normalizedDoubleStackValues holds absolute canvas y-positions corresponding to each point
-                    // (rather than incremental y-positions as the dataPoints valueStacks hold).
-                    // E.g. (canvas height = 100)
-                    //      dataPoint valueStack = {10, 10, 20}
-                    //        ->
-                    //      normalized valueStack = {25, 50, 100}
-                    sum += value.doubleValue;
-                    double normalizedValue = (sum - self.minimumValue) / range * viewHeight;
-                    normalizedValue = floor(viewHeight - normalizedValue);
-                    
-                    [normalizedDoubleStackValues addObject:@(normalizedValue)];
-                }
-            }
-            [normalizedDataPoints addObject:[[SFValueStack alloc] initWithStackedValues:normalizedDoubleStackValues]];
+- (void)getProvidedMinimumValue:(double *)minimumValue maximumValue:(double *)maximumValue {
+    [super getProvidedMinimumValue:minimumValue maximumValue:maximumValue];
+    if (*minimumValue == SFDoubleInvalidValue) {
+        // Bars grow from 0 unless the data source provides a minimum value
+        *minimumValue = 0;
+    }
+}
+
+- (UIColor *)colorForPlotIndex:(NSInteger)plotIndex subpointIndex:(NSInteger)subpointIndex totalSubpoints:(NSInteger)totalSubpoints {
+    return SFOpaqueColorWithReducedAlphaFromBaseColor([super colorForPlotIndex:plotIndex subpointIndex:subpointIndex totalSubpoints:(NSInteger)totalSubpoints], subpointIndex, totalSubpoints);
+}
+
+- (void)updateLineLayersForPlotIndex:(NSInteger)plotIndex {
+    // Bars with the same number of stacked values share one layer per stack level, as their stack
+    // levels share a color; the layers for each number of stacked values form one line layer entry
+    SFGraphChartPlotBuffer *plotBuffer = self.plotBuffers[plotIndex];
+    NSMutableIndexSet *stackCounts = [NSMutableIndexSet new];
+    NSUInteger pointCount = plotBuffer.count;
+    for (NSUInteger pointIndex = 0; pointIndex < pointCount; pointIndex++) {
+        if (![plotBuffer isUnsetAtIndex:pointIndex]) {
+            [stackCounts addIndex:[plotBuffer numberOfStackedValuesAtIndex:pointIndex]];
         }
     }
+    [stackCounts removeIndex:0];
     
-    return normalizedDataPoints;
+    [stackCounts enumerateIndexesUsingBlock:^(NSUInteger numberOfStackedValues, BOOL *stop) {
+        NSMutableArray *lineLayers = [NSMutableArray new];
+        for (NSUInteger index = 0; index < numberOfStackedValues; index++) {
+            CAShapeLayer *lineLayer = [self dequeueReusableLineLayer];
+            lineLayer.strokeColor = [self colorForPlotIndex:plotIndex subpointIndex:index totalSubpoints:numberOfStackedValues].CGColor;
+            lineLayer.lineWidth = BarWidth;
+            [self.plotView.layer addSublayer:lineLayer];
+            [lineLayers addObject:lineLayer];
+        }
+        [self.lineLayers[plotIndex] addObject:lineLayers];
+    }];
 }
 
-- (void)calculateMinAndMaxValues {
-    self.minimumValue = SFDoubleInvalidValue;
-    self.maximumValue = SFDoubleInvalidValue;
-    
-    BOOL maximumValueProvided = NO;
-    
-    if ([self.dataSource respondsToSelector:@selector(minimumValueForGraphChartView:)]) {
-        self.minimumValue = [self.dataSource minimumValueForGraphChartView:self];
-    } else {
-        self.minimumValue = 0;
-    }
+- (void)layoutLineLayersForPlotIndex:(NSInteger)plotIndex {
+    SFGraphChartPlotBuffer *plotBuffer = self.plotBuffers[plotIndex];
+    NSArray<NSMutableArray<CAShapeLayer *> *> *plotLineLayers = self.lineLayers[plotIndex];
     
-    if ([self.dataSource respondsToSelector:@selector(maximumValueForGraphChartView:)]) {
-        self.maximumValue = [self.dataSource maximumValueForGraphChartView:self];
-        maximumValueProvided = YES;
+    // One path per line layer, looked up by number of stacked values and stack level
+    NSMutableDictionary<NSNumber *, NSArray *> *linePaths = [NSMutableDictionary new];
+    for (NSArray<CAShapeLayer *> *lineLayers in plotLineLayers) {
+        NSMutableArray *paths = [NSMutableArray arrayWithCapacity:lineLayers.count];
+        for (NSUInteger index = 0; index < lineLayers.count; index++) {
+            CGMutablePathRef path = CGPathCreateMutable();
+            [paths addObject:(__bridge_transfer id)path];
+        }
+        linePaths[@(lineLayers.count)] = paths;
     }
     
-    if (!maximumValueProvided) {
-        NSInteger numberOfPlots = [self numberOfPlots];
-        for (NSInteger plotIndex = 0; plotIndex < numberOfPlots; plotIndex++) {
-            NSInteger numberOfPlotPoints = self.dataPoints[plotIndex].count;
-            for (NSInteger pointIndex = 0; pointIndex < numberOfPlotPoints; pointIndex++) {
-                SFValueStack *point = self.dataPoints[plotIndex][pointIndex];
-                if (!maximumValueProvided &&
-                    point.totalValue != SFDoubleInvalidValue &&
-                    ((self.maximumValue == SFDoubleInvalidValue) || (point.totalValue > self.maximumValue))) {
-                    self.maximumValue = point.totalValue;
-                }
-            }
+    CGFloat xOffset = [self xOffsetForPlotIndex:plotIndex];
+    NSRange visibleRange = [self visibleXAxisPointRange];
+    NSRange culledRange = [self culledXAxisPointRangeForPlotIndex:plotIndex];
+    for (NSUInteger pointIndex = culledRange.location; pointIndex < NSMaxRange(culledRange); pointIndex++) {
+        if ([plotBuffer isUnsetAtIndex:pointIndex]) {
+            continue;
+        }
+        NSUInteger numberOfSubpoints = [plotBuffer numberOfStackedValuesAtIndex:pointIndex];
+        if (numberOfSubpoints == 0) {
+            continue;
+        }
+        
+        NSArray *paths = linePaths[@(numberOfSubpoints)];
+        const double *positionsOnYAxis = plotBuffer.canvasStackSums + plotBuffer.stackOffsets[pointIndex];
+        double positionOnXAxis = xAxisPointInRange(pointIndex, visibleRange, self.plotView.bounds.size.width) + xOffset;
+        double previousYValue = self.plotView.bounds.size.height;
+        for (NSUInteger subpointIndex = 0; subpointIndex < numberOfSubpoints; subpointIndex++) {
+            double positionOnYAxis = positionsOnYAxis[subpointIndex];
+            double barHeight = fabs(positionOnYAxis - previousYValue);
+            
+            CGMutablePathRef path = (__bridge CGMutablePathRef)paths[subpointIndex];
+            CGPathMoveToPoint(path, NULL, positionOnXAxis, previousYValue + scalePixelAdjustment());
+            CGPathAddLineToPoint(path, NULL, positionOnXAxis, previousYValue + scalePixelAdjustment() - barHeight);
+            
+            previousYValue = positionOnYAxis;
         }
     }
     
-    if (self.maximumValue == SFDoubleInvalidValue) {
-        self.maximumValue = 0;
+    for (NSArray<CAShapeLayer *> *lineLayers in plotLineLayers) {
+        NSArray *paths = linePaths[@(lineLayers.count)];
+        for (NSUInteger index = 0; index < lineLayers.count; index++) {
+            lineLayers[index].path = (__bridge CGPathRef)paths[index];
+        }
     }
 }
 
-- (UIColor *)colorForPlotIndex:(NSInteger)plotIndex subpointIndex:(NSInteger)subpointIndex totalSubpoints:(NSInteger)totalSubpoints {
-    return SFOpaqueColorWithReducedAlphaFromBaseColor([super colorForPlotIndex:plotIndex subpointIndex:subpointIndex totalSubpoints:(NSInteger)totalSubpoints], subpointIndex, totalSubpoints);
+#pragma mark - Tiled Rendering
+
+- (NSInteger)renderingComplexityForPlotIndex:(NSInteger)plotIndex {
+    SFGraphChartPlotBuffer *plotBuffer = self.plotBuffers[plotIndex];
+    if (plotBuffer.stackOffsets == NULL) {
+        return 0;
+    }
+    // Each stacked value of a culled bar is a line of two vertices
+    NSRange culledRange = [self culledXAxisPointRangeForPlotIndex:plotIndex];
+    return 2 * (plotBuffer.stackOffsets[NSMaxRange(culledRange)] - plotBuffer.stackOffsets[culledRange.location]);
 }
 
-- (void)updateLineLayersForPlotIndex:(NSInteger)plotIndex {
-    NSUInteger pointCount = self.dataPoints[plotIndex].count;
-    for (NSUInteger pointIndex = 0; pointIndex < pointCount; pointIndex++) {
-        SFValueStack *dataPointValue = self.dataPoints[plotIndex][pointIndex];
-        NSMutableArray *lineLayers = [NSMutableArray new];
-        if (!dataPointValue.isUnset) {
-            NSUInteger numberOfStackedValues = dataPointValue.stackedValues.count;
-            for (NSUInteger index = 0; index < numberOfStackedValues; index++) {
-                CAShapeLayer *lineLayer = [CAShapeLayer layer];
-                lineLayer.strokeColor = [self colorForPlotIndex:plotIndex subpointIndex:index totalSubpoints:numberOfStackedValues].CGColor;
-                lineLayer.lineWidth = BarWidth;
-                [self.plotView.layer addSublayer:lineLayer];
-                [lineLayers addObject:lineLayer];
+- (SFGraphChartTileDrawingBlock)tileDrawingBlockForPlotIndex:(NSInteger)plotIndex geometry:(SFGraphChartTileGeometry)geometry {
+    SFGraphChartPlotBuffer *plotBuffer = self.plotBuffers[plotIndex];
+    if (plotBuffer.stackOffsets == NULL) {
+        return nil;
+    }
+    
+    NSInteger numberOfPoints = geometry.numberOfPoints;
+    NSData *stackOffsetData = [NSData dataWithBytes:plotBuffer.stackOffsets length:(numberOfPoints + 1) * sizeof(NSInteger)];
+    NSData *stackSumData = [NSData dataWithBytes:plotBuffer.stackSums length:plotBuffer.stackOffsets[numberOfPoints] * sizeof(double)];
+    
+    // The colors of each stack level, looked up by number of stacked values
+    NSMutableDictionary<NSNumber *, NSArray<UIColor *> *> *stackColors = [NSMutableDictionary new];
+    for (NSInteger pointIndex = 0; pointIndex < numberOfPoints; pointIndex++) {
+        NSInteger numberOfStackedValues = plotBuffer.stackOffsets[pointIndex + 1] - plotBuffer.stackOffsets[pointIndex];
+        if (numberOfStackedValues > 0 && !stackColors[@(numberOfStackedValues)]) {
+            NSMutableArray<UIColor *> *colors = [NSMutableArray arrayWithCapacity:numberOfStackedValues];
+            for (NSInteger index = 0; index < numberOfStackedValues; index++) {
+                [colors addObject:[self colorForPlotIndex:plotIndex subpointIndex:index totalSubpoints:numberOfStackedValues]];
             }
+            stackColors[@(numberOfStackedValues)] = colors;
         }
-        [self.lineLayers[plotIndex] addObject:lineLayers];
     }
-}
-
-- (void)layoutLineLayersForPlotIndex:(NSInteger)plotIndex {
-    NSUInteger lineLayerIndex = 0;
-    double positionOnXAxis = SFDoubleInvalidValue;
-    SFValueStack *positionsOnYAxis = nil;
-    NSUInteger pointCount = self.yAxisPoints[plotIndex].count;
-    for (NSUInteger pointIndex = 0; pointIndex < pointCount; pointIndex++) {
-        float previousYValue = self.plotView.bounds.size.height;
-
-        SFValueStack *dataPointValue = self.dataPoints[plotIndex][pointIndex];
-        positionsOnYAxis = self.yAxisPoints[plotIndex][pointIndex];
-
-        if (!dataPointValue.isUnset) {
-            NSUInteger numberOfSubpoints = positionsOnYAxis.stackedValues.count;
-            for (NSUInteger subpointIndex = 0; subpointIndex < numberOfSubpoints; subpointIndex++) {
-                double positionOnYAxis = positionsOnYAxis.stackedValues[subpointIndex].doubleValue;
-                UIBezierPath *linePath = [UIBezierPath bezierPath];
-                
-                double barHeight = fabs(positionOnYAxis - previousYValue);
-
-                positionOnXAxis = xAxisPoint(pointIndex, self.numberOfXAxisPoints, self.plotView.bounds.size.width);
-                positionOnXAxis += [self xOffsetForPlotIndex:plotIndex];
-                
-                [linePath moveToPoint:CGPointMake(positionOnXAxis, previousYValue + scalePixelAdjustment())];
-                [linePath addLineToPoint:CGPointMake(positionOnXAxis, previousYValue + scalePixelAdjustment() - barHeight)];
-                
+    
+    NSDictionary<NSNumber *, NSArray<UIColor *> *> *colorsByNumberOfStackedValues = [stackColors copy];
+    geometry.pointMargin = BarWidth / 2;
+    CGFloat pixelAdjustment = scalePixelAdjustment();
+    return ^(CGContextRef context, CGRect rect) {
+        const NSInteger *stackOffsets = stackOffsetData.bytes;
+        const double *stackSums = stackSumData.bytes;
+        NSRange pointRange = SFGraphChartTilePointRange(&geometry, CGRectGetMinX(rect), CGRectGetMaxX(rect));
+        for (NSInteger pointIndex = pointRange.location; pointIndex < NSMaxRange(pointRange); pointIndex++) {
+            NSInteger numberOfStackedValues = stackOffsets[pointIndex + 1] - stackOffsets[pointIndex];
+            if (numberOfStackedValues == 0) {
+                continue;
+            }
+            
+            NSArray<UIColor *> *colors = colorsByNumberOfStackedValues[@(numberOfStackedValues)];
+            CGFloat positionOnXAxis = SFGraphChartTileXPosition(&geometry, pointIndex);
+            CGFloat previousYValue = geometry.canvasHeight;
+            for (NSInteger subpointIndex = 0; subpointIndex < numberOfStackedValues; subpointIndex++) {
+                CGFloat positionOnYAxis = SFGraphChartTileYPosition(&geometry, stackSums[stackOffsets[pointIndex] + subpointIndex]);
+                CGFloat barHeight = fabs(positionOnYAxis - previousYValue);
+                CGContextSetFillColorWithColor(context, colors[subpointIndex].CGColor);
+                CGContextFillRect(context, CGRectMake(positionOnXAxis - BarWidth / 2,
+                                                      previousYValue + pixelAdjustment - barHeight,
+                                                      BarWidth,
+                                                      barHeight));
                 previousYValue = positionOnYAxis;
-                
-                CAShapeLayer *lineLayer = self.lineLayers[plotIndex][pointIndex][subpointIndex];
-                lineLayer.path = linePath.CGPath;
-                lineLayerIndex++;
             }
         }
-    }
+    };
 }
 
 #pragma mark - Scrubbing
 
 - (double)scrubbingValueForPlotIndex:(NSInteger)plotIndex pointIndex:(NSInteger)pointIndex {
-    return self.dataPoints[plotIndex][pointIndex].totalValue;
+    return self.plotBuffers[plotIndex].maximumValues[pointIndex];
 }
 
 - (double)scrubbingYAxisPointForPlotIndex:(NSInteger)plotIndex pointIndex:(NSInteger)pointIndex {
-    return self.yAxisPoints[plotIndex][pointIndex].stackedValues.lastObject.doubleValue; // totalValue is not normalized to canvas coordinates
+    SFGraphChartPlotBuffer *plotBuffer = self.plotBuffers[plotIndex];
+    if ([plotBuffer numberOfStackedValuesAtIndex:pointIndex] == 0) {
+        return 0;
+    }
+    // The total value is not normalized to canvas coordinates, the last stack sum is
+    return plotBuffer.canvasStackSums[plotBuffer.stackOffsets[pointIndex + 1] - 1];
 }
 
 - (CGFloat)xOffsetForPlotIndex:(NSInteger)plotIndex {
     return xOffsetForPlotIndex(plotIndex, [self numberOfPlots], BarWidth);
 }
 
+#pragma mark - Selection
+
+- (BOOL)getSelectedPointIndex:(NSInteger *)selectedPointIndex plotIndex:(NSInteger *)selectedPlotIndex subpointIndex:(NSInteger *)selectedSubpointIndex atCanvasPoint:(CGPoint)point {
+    // The bars of each plot are found by a binary search of their x positions, keeping the closest one under the point
+    BOOL selected = NO;
+    CGFloat closestDistance = CGFLOAT_MAX;
+    NSInteger numberOfPlots = self.plotBuffers.count;
+    for (NSInteger plotIndex = 0; plotIndex < numberOfPlots; plotIndex++) {
+        if (self.plotBuffers[plotIndex].stackOffsets == NULL) {
+            continue;
+        }
+        CGFloat xOffset = [self xOffsetForPlotIndex:plotIndex];
+        NSInteger pointIndex = [self pointIndexNearestToXPosition:point.x - xOffset plotIndex:plotIndex maximumDistance:BarWidth / 2 + SFGraphChartViewSelectionHitSlop];
+        if (pointIndex == NSNotFound || !NSLocationInRange(pointIndex, [self culledXAxisPointRangeForPlotIndex:plotIndex])) {
+            continue;
+        }
+        NSInteger subpointIndex = [self stackLevelAtYPosition:point.y pointIndex:pointIndex plotIndex:plotIndex];
+        CGFloat distance = fabs([self canvasXPositionsForPlotIndex:plotIndex][pointIndex] + xOffset - point.x);
+        if (subpointIndex != NSNotFound && distance < closestDistance) {
+            closestDistance = distance;
+            *selectedPointIndex = pointIndex;
+            *selectedPlotIndex = plotIndex;
+            *selectedSubpointIndex = subpointIndex;
+            selected = YES;
+        }
+    }
+    return selected;
+}
+
+- (NSInteger)stackLevelAtYPosition:(CGFloat)yPosition pointIndex:(NSInteger)pointIndex plotIndex:(NSInteger)plotIndex {
+    SFGraphChartPlotBuffer *plotBuffer = self.plotBuffers[plotIndex];
+    NSInteger numberOfStackedValues = [plotBuffer numberOfStackedValuesAtIndex:pointIndex];
+    if (numberOfStackedValues == 0) {
+        return NSNotFound;
+    }
+    const double *stackBoundaries = plotBuffer.canvasStackSums + plotBuffer.stackOffsets[pointIndex];
+    if (yPosition > self.plotView.bounds.size.height + SFGraphChartViewSelectionHitSlop
+        || yPosition < stackBoundaries[numberOfStackedValues - 1] - SFGraphChartViewSelectionHitSlop) {
+        return NSNotFound;
+    }
+    
+    // Each stacked value ends above the previous one, so the boundaries are sorted by descending y; the
+    // stack level under the point is the first one ending at or above it
+    NSInteger lowIndex = 0;
+    NSInteger highIndex = numberOfStackedValues - 1;
+    while (lowIndex < highIndex) {
+        NSInteger middleIndex = lowIndex + (highIndex - lowIndex) / 2;
+        if (stackBoundaries[middleIndex] <= yPosition) {
+            highIndex = middleIndex;
+        } else {
+            lowIndex = middleIndex + 1;
+        }
+    }
+    return lowIndex;
+}
+
 - (CGFloat)snappedXPosition:(CGFloat)xPosition plotIndex:(NSInteger)plotIndex {
     return [super snappedXPosition:xPosition plotIndex:plotIndex] + [self xOffsetForPlotIndex:plotIndex];
 }
@@ -37,6 +37,12 @@
 
 
 NS_ASSUME_NONNULL_BEGIN
+/**
+ The value denoting an unset or invalid chart value. An `SFValueRange` object with both its
+ `minimumValue` and `maximumValue` equal to this value is unset.
+ */
+SF_EXTERN const double SFDoubleInvalidValue;
+
 /**
  Defines the common attributes of chart values.
  */
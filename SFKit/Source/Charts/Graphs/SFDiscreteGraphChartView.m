@@ -89,13 +89,18 @@
 #endif
 
 
-@implementation SFDiscreteGraphChartView
+@implementation SFDiscreteGraphChartView {
+    NSMutableDictionary<NSNumber *, NSData *> *_lineLayerOffsets; // Index of the first line layer of each point, followed by the number of line layers
+    NSMutableDictionary<NSNumber *, NSValue *> *_visibleLineLayerRanges; // Line layers positioned by the last layout pass
+}
 
 #pragma mark - Init
 
 - (void)sharedInit {
     [super sharedInit];
     _drawsConnectedRanges = YES;
+    _lineLayerOffsets = [NSMutableDictionary new];
+    _visibleLineLayerRanges = [NSMutableDictionary new];
 }
 
 - (void)setDrawsConnectedRanges:(BOOL)drawsConnectedRanges {
@@ -112,12 +117,29 @@
     return [self numberOfValidValuesForPlotIndex:plotIndex] > 0 && _drawsConnectedRanges;
 }
 
+- (void)updateLineLayers {
+    [_lineLayerOffsets removeAllObjects];
+    [_visibleLineLayerRanges removeAllObjects];
+    [super updateLineLayers];
+}
+
+- (void)updateLineLayersReplacingExistingForPlotIndex:(NSInteger)plotIndex {
+    [_lineLayerOffsets removeObjectForKey:@(plotIndex)];
+    [_visibleLineLayerRanges removeObjectForKey:@(plotIndex)];
+    [super updateLineLayersReplacingExistingForPlotIndex:plotIndex];
+}
+
 - (void)updateLineLayersForPlotIndex:(NSInteger)plotIndex {
-    NSUInteger pointCount = self.dataPoints[plotIndex].count;
+    SFGraphChartPlotBuffer *plotBuffer = self.plotBuffers[plotIndex];
+    NSUInteger pointCount = plotBuffer.count;
+    NSMutableData *lineLayerOffsetData = [NSMutableData dataWithLength:(pointCount + 1) * sizeof(NSInteger)];
+    NSInteger *lineLayerOffsets = lineLayerOffsetData.mutableBytes;
     for (NSUInteger pointIndex = 0; pointIndex < pointCount; pointIndex++) {
-        SFValueRange *dataPointValue = self.dataPoints[plotIndex][pointIndex];
-        if (!dataPointValue.isUnset && !dataPointValue.isEmptyRange) {
-            CAShapeLayer *lineLayer = graphLineLayer();
+        lineLayerOffsets[pointIndex] = self.lineLayers[plotIndex].count;
+        // Unset values have equal minimum and maximum values, so they are skipped as empty ranges
+        if (plotBuffer.minimumValues[pointIndex] != plotBuffer.maximumValues[pointIndex]) {
+            CAShapeLayer *lineLayer = [self dequeueReusableLineLayer];
+            setUpGraphLineLayer(lineLayer);
             lineLayer.strokeColor = [self colorForPlotIndex:plotIndex].CGColor;
             lineLayer.lineWidth = SFGraphChartViewPointAndLineWidth;
             
@@ -125,38 +147,149 @@
             [self.lineLayers[plotIndex] addObject:[NSMutableArray arrayWithObject:lineLayer]];
         }
     }
+    lineLayerOffsets[pointCount] = self.lineLayers[plotIndex].count;
+    _lineLayerOffsets[@(plotIndex)] = lineLayerOffsetData;
+    // New layers are visible until the first layout pass positions or hides them
+    _visibleLineLayerRanges[@(plotIndex)] = [NSValue valueWithRange:NSMakeRange(0, self.lineLayers[plotIndex].count)];
 }
 
 - (void)layoutLineLayersForPlotIndex:(NSInteger)plotIndex {
-    NSUInteger lineLayerIndex = 0;
+    SFGraphChartPlotBuffer *plotBuffer = self.plotBuffers[plotIndex];
+    const NSInteger *lineLayerOffsets = _lineLayerOffsets[@(plotIndex)].bytes;
+    if (!lineLayerOffsets) {
+        return;
+    }
+    
+    // Line layers belong to every non-empty range, but only the ones of the culled range are positioned;
+    // the ones positioned by the previous layout pass which left the range are hidden
+    NSArray<NSMutableArray<CAShapeLayer *> *> *lineLayers = self.lineLayers[plotIndex];
+    NSRange culledRange = NSIntersectionRange([self culledXAxisPointRangeForPlotIndex:plotIndex], NSMakeRange(0, plotBuffer.count));
+    if (culledRange.length == 0) {
+        culledRange.location = 0;
+    }
+    NSInteger firstLineLayerIndex = lineLayerOffsets[culledRange.location];
+    NSRange lineLayerRange = NSMakeRange(firstLineLayerIndex, lineLayerOffsets[NSMaxRange(culledRange)] - firstLineLayerIndex);
+    NSRange previousLineLayerRange = _visibleLineLayerRanges[@(plotIndex)].rangeValue;
+    for (NSUInteger lineLayerIndex = previousLineLayerRange.location; lineLayerIndex < NSMaxRange(previousLineLayerRange); lineLayerIndex++) {
+        if (!NSLocationInRange(lineLayerIndex, lineLayerRange)) {
+            lineLayers[lineLayerIndex][0].hidden = YES;
+        }
+    }
+    
+    NSUInteger lineLayerIndex = lineLayerRange.location;
     CGFloat positionOnXAxis = SFCGFloatInvalidValue;
-    SFValueRange *positionOnYAxis = nil;
-    NSUInteger pointCount = self.yAxisPoints[plotIndex].count;
-    for (NSUInteger pointIndex = 0; pointIndex < pointCount; pointIndex++) {
-        
-        SFValueRange *dataPointValue = self.dataPoints[plotIndex][pointIndex];
+    NSRange visibleRange = [self visibleXAxisPointRange];
+    for (NSUInteger pointIndex = culledRange.location; pointIndex < NSMaxRange(culledRange); pointIndex++) {
         
-        if (!dataPointValue.isUnset && !dataPointValue.isEmptyRange) {
+        if (plotBuffer.minimumValues[pointIndex] != plotBuffer.maximumValues[pointIndex]) {
+            
+            CAShapeLayer *lineLayer = lineLayers[lineLayerIndex][0];
+            lineLayerIndex++;
+            lineLayer.hidden = NO;
             
             UIBezierPath *linePath = [UIBezierPath bezierPath];
             
-            positionOnXAxis = xAxisPoint(pointIndex, self.numberOfXAxisPoints, self.plotView.bounds.size.width);
+            positionOnXAxis = xAxisPointInRange(pointIndex, visibleRange, self.plotView.bounds.size.width);
             positionOnXAxis += [self xOffsetForPlotIndex:plotIndex];
-            positionOnYAxis = self.yAxisPoints[plotIndex][pointIndex];
             
-            [linePath moveToPoint:CGPointMake(positionOnXAxis, positionOnYAxis.minimumValue)];
-            [linePath addLineToPoint:CGPointMake(positionOnXAxis, positionOnYAxis.maximumValue)];
+            [linePath moveToPoint:CGPointMake(positionOnXAxis, plotBuffer.canvasMinimumValues[pointIndex])];
+            [linePath addLineToPoint:CGPointMake(positionOnXAxis, plotBuffer.canvasMaximumValues[pointIndex])];
             
-            CAShapeLayer *lineLayer = self.lineLayers[plotIndex][lineLayerIndex][0];
             lineLayer.path = linePath.CGPath;
-            lineLayerIndex++;
         }
     }
+    _visibleLineLayerRanges[@(plotIndex)] = [NSValue valueWithRange:lineLayerRange];
+}
+
+#pragma mark - Tiled Rendering
+
+- (NSInteger)renderingComplexityForPlotIndex:(NSInteger)plotIndex {
+    // Only the line layers of the culled ranges are laid out
+    NSInteger numberOfLineLayers = _drawsConnectedRanges ? [self culledXAxisPointRangeForPlotIndex:plotIndex].length : 0;
+    return [super renderingComplexityForPlotIndex:plotIndex] + numberOfLineLayers;
+}
+
+- (SFGraphChartTileDrawingBlock)tileDrawingBlockForPlotIndex:(NSInteger)plotIndex geometry:(SFGraphChartTileGeometry)geometry {
+    SFGraphChartPlotBuffer *plotBuffer = self.plotBuffers[plotIndex];
+    NSData *minimumValueData = [NSData dataWithBytes:plotBuffer.minimumValues length:geometry.numberOfPoints * sizeof(double)];
+    NSData *maximumValueData = [NSData dataWithBytes:plotBuffer.maximumValues length:geometry.numberOfPoints * sizeof(double)];
+    UIColor *color = [self colorForPlotIndex:plotIndex];
+    BOOL drawsConnectedRanges = _drawsConnectedRanges;
+    geometry.pointMargin = SFGraphChartViewPointAndLineWidth / 2;
+    return ^(CGContextRef context, CGRect rect) {
+        const double *minimumValues = minimumValueData.bytes;
+        const double *maximumValues = maximumValueData.bytes;
+        NSRange pointRange = SFGraphChartTilePointRange(&geometry, CGRectGetMinX(rect), CGRectGetMaxX(rect));
+        CGMutablePathRef linePath = CGPathCreateMutable();
+        CGMutablePathRef pointPath = CGPathCreateMutable();
+        for (NSInteger pointIndex = pointRange.location; pointIndex < NSMaxRange(pointRange); pointIndex++) {
+            if (SFGraphValueIsUnset(minimumValues[pointIndex], maximumValues[pointIndex])) {
+                continue;
+            }
+            CGFloat positionOnXAxis = SFGraphChartTileXPosition(&geometry, pointIndex);
+            CGPoint minimumPoint = CGPointMake(positionOnXAxis, SFGraphChartTileYPosition(&geometry, minimumValues[pointIndex]));
+            addPointIndicatorToPath(pointPath, minimumPoint);
+            if (minimumValues[pointIndex] != maximumValues[pointIndex]) {
+                CGPoint maximumPoint = CGPointMake(positionOnXAxis, SFGraphChartTileYPosition(&geometry, maximumValues[pointIndex]));
+                addPointIndicatorToPath(pointPath, maximumPoint);
+                if (drawsConnectedRanges) {
+                    CGPathMoveToPoint(linePath, NULL, minimumPoint.x, minimumPoint.y);
+                    CGPathAddLineToPoint(linePath, NULL, maximumPoint.x, maximumPoint.y);
+                }
+            }
+        }
+        
+        CGContextSetStrokeColorWithColor(context, color.CGColor);
+        CGContextSetLineWidth(context, SFGraphChartViewPointAndLineWidth);
+        CGContextSetLineCap(context, kCGLineCapRound);
+        CGContextSetLineJoin(context, kCGLineJoinRound);
+        CGContextAddPath(context, linePath);
+        CGContextStrokePath(context);
+        
+        // Point indicators are drawn over the ranges
+        CGContextSetFillColorWithColor(context, [UIColor whiteColor].CGColor);
+        CGContextSetLineWidth(context, SFGraphChartViewPointIndicatorLineWidth);
+        CGContextAddPath(context, pointPath);
+        CGContextDrawPath(context, kCGPathFillStroke);
+        
+        CGPathRelease(linePath);
+        CGPathRelease(pointPath);
+    };
 }
 
 - (CGFloat)xOffsetForPlotIndex:(NSInteger)plotIndex {
     return xOffsetForPlotIndex(plotIndex, [self numberOfPlots], SFGraphChartViewPointAndLineWidth);
 }
+
+#pragma mark - Selection
+
+- (BOOL)getSelectedPointIndex:(NSInteger *)selectedPointIndex plotIndex:(NSInteger *)selectedPlotIndex subpointIndex:(NSInteger *)selectedSubpointIndex atCanvasPoint:(CGPoint)point {
+    // The ranges of each plot are found by a binary search of their x positions, keeping the closest one under the point
+    BOOL selected = NO;
+    CGFloat closestDistance = CGFLOAT_MAX;
+    CGFloat reach = SFGraphChartViewPointAndLineWidth / 2 + SFGraphChartViewSelectionHitSlop;
+    NSInteger numberOfPlots = self.plotBuffers.count;
+    for (NSInteger plotIndex = 0; plotIndex < numberOfPlots; plotIndex++) {
+        SFGraphChartPlotBuffer *plotBuffer = self.plotBuffers[plotIndex];
+        CGFloat xOffset = [self xOffsetForPlotIndex:plotIndex];
+        NSInteger pointIndex = [self pointIndexNearestToXPosition:point.x - xOffset plotIndex:plotIndex maximumDistance:reach];
+        if (pointIndex == NSNotFound || !NSLocationInRange(pointIndex, [self culledXAxisPointRangeForPlotIndex:plotIndex])
+            || [plotBuffer isUnsetAtIndex:pointIndex]) {
+            continue;
+        }
+        double minimumYPosition = MIN(plotBuffer.canvasMinimumValues[pointIndex], plotBuffer.canvasMaximumValues[pointIndex]);
+        double maximumYPosition = MAX(plotBuffer.canvasMinimumValues[pointIndex], plotBuffer.canvasMaximumValues[pointIndex]);
+        CGFloat distance = fabs([self canvasXPositionsForPlotIndex:plotIndex][pointIndex] + xOffset - point.x);
+        if (point.y >= minimumYPosition - reach && point.y <= maximumYPosition + reach && distance < closestDistance) {
+            closestDistance = distance;
+            *selectedPointIndex = pointIndex;
+            *selectedPlotIndex = plotIndex;
+            *selectedSubpointIndex = 0;
+            selected = YES;
+        }
+    }
+    return selected;
+}
     
 - (CGFloat)snappedXPosition:(CGFloat)xPosition plotIndex:(NSInteger)plotIndex {
     return [super snappedXPosition:xPosition plotIndex:plotIndex] + [self xOffsetForPlotIndex:plotIndex];
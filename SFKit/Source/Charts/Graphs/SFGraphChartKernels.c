@@ -0,0 +1,213 @@
+//
+//  SFGraphChartKernels.c
+//  SFKit
+//
+//  Created by David Moore on 10/17/26.
+//  Copyright © 2026 Moore Development. All rights reserved.
+//
+
+#include "SFGraphChartKernels.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__APPLE__)
+#include <Accelerate/Accelerate.h>
+#define SF_GRAPH_KERNELS_ACCELERATE 1
+#elif defined(__GNUC__)
+#define SF_GRAPH_KERNELS_VECTOR_EXTENSIONS 1
+#endif
+
+#if SF_GRAPH_KERNELS_VECTOR_EXTENSIONS
+
+// Two lanes match the SSE2 and NEON register width
+typedef double SFDouble2 __attribute__((vector_size(2 * sizeof(double))));
+typedef int64_t SFMask2 __attribute__((vector_size(2 * sizeof(int64_t))));
+
+static inline SFDouble2 SFDouble2Load(const double *values) {
+    SFDouble2 vector;
+    memcpy(&vector, values, sizeof(vector));
+    return vector;
+}
+
+static inline void SFDouble2Store(double *values, SFDouble2 vector) {
+    memcpy(values, &vector, sizeof(vector));
+}
+
+static inline SFDouble2 SFDouble2Splat(double value) {
+    return (SFDouble2){value, value};
+}
+
+// Picks the lanes of a where mask is set and the lanes of b elsewhere
+static inline SFDouble2 SFDouble2Select(SFMask2 mask, SFDouble2 a, SFDouble2 b) {
+    return (SFDouble2)(((SFMask2)a & mask) | ((SFMask2)b & ~mask));
+}
+
+#endif
+
+static double SFGraphKernelMaskedMinimum(const double *values, long count, double minimum) {
+    // Unset values are the highest representable value, so they never win the comparison
+    for (long index = 0; index < count; index++) {
+        minimum = (values[index] < minimum) ? values[index] : minimum;
+    }
+    return minimum;
+}
+
+static double SFGraphKernelMaskedMaximum(const double *values, long count, double maximum) {
+    for (long index = 0; index < count; index++) {
+        double value = values[index];
+        maximum = (value != SFGraphKernelUnsetValue && value > maximum) ? value : maximum;
+    }
+    return maximum;
+}
+
+double SFGraphKernelMinimum(const double *values, long count) {
+    if (count <= 0) {
+        return SFGraphKernelUnsetValue;
+    }
+#if SF_GRAPH_KERNELS_ACCELERATE
+    double minimum = SFGraphKernelUnsetValue;
+    vDSP_minvD(values, 1, &minimum, (vDSP_Length)count);
+    return minimum;
+#elif SF_GRAPH_KERNELS_VECTOR_EXTENSIONS
+    SFDouble2 minimums = SFDouble2Splat(SFGraphKernelUnsetValue);
+    long index = 0;
+    for (; index + 2 <= count; index += 2) {
+        SFDouble2 vector = SFDouble2Load(values + index);
+        minimums = SFDouble2Select((SFMask2)(vector < minimums), vector, minimums);
+    }
+    double minimum = SFGraphKernelMaskedMinimum((const double *)&minimums, 2, SFGraphKernelUnsetValue);
+    return SFGraphKernelMaskedMinimum(values + index, count - index, minimum);
+#else
+    return SFGraphKernelMaskedMinimum(values, count, SFGraphKernelUnsetValue);
+#endif
+}
+
+double SFGraphKernelMaximum(const double *values, long count) {
+    if (count <= 0) {
+        return SFGraphKernelUnsetValue;
+    }
+#if SF_GRAPH_KERNELS_ACCELERATE
+    double maximum = -INFINITY;
+    vDSP_maxvD(values, 1, &maximum, (vDSP_Length)count);
+    if (maximum == SFGraphKernelUnsetValue) {
+        // Unset values are present, so the mask has to be applied
+        maximum = SFGraphKernelMaskedMaximum(values, count, -INFINITY);
+    }
+#elif SF_GRAPH_KERNELS_VECTOR_EXTENSIONS
+    const SFDouble2 unsetValues = SFDouble2Splat(SFGraphKernelUnsetValue);
+    SFDouble2 maximums = SFDouble2Splat(-INFINITY);
+    long index = 0;
+    for (; index + 2 <= count; index += 2) {
+        SFDouble2 vector = SFDouble2Load(values + index);
+        SFMask2 mask = (SFMask2)(vector > maximums) & (SFMask2)(vector != unsetValues);
+        maximums = SFDouble2Select(mask, vector, maximums);
+    }
+    double maximum = SFGraphKernelMaskedMaximum((const double *)&maximums, 2, -INFINITY);
+    maximum = SFGraphKernelMaskedMaximum(values + index, count - index, maximum);
+#else
+    double maximum = SFGraphKernelMaskedMaximum(values, count, -INFINITY);
+#endif
+    return (maximum == -INFINITY) ? SFGraphKernelUnsetValue : maximum;
+}
+
+void SFGraphKernelMapToCanvas(const double *values, double *canvasValues, long count,
+                              double minimumValue, double maximumValue, double canvasHeight,
+                              double unsetCanvasValue) {
+    if (count <= 0) {
+        return;
+    }
+    
+    // canvasHeight - (value - minimumValue) / (maximumValue - minimumValue) * canvasHeight, as value * scale + offset
+    double scale = 0;
+    double offset = canvasHeight / 2;
+    if (minimumValue != maximumValue) {
+        scale = -canvasHeight / (maximumValue - minimumValue);
+        offset = canvasHeight - minimumValue * scale;
+    }
+    
+#if SF_GRAPH_KERNELS_ACCELERATE
+    // Unset values are restored from the mask afterwards, so the mapping cannot run in place
+    if (values == canvasValues) {
+        for (long index = 0; index < count; index++) {
+            canvasValues[index] = (values[index] == SFGraphKernelUnsetValue) ? unsetCanvasValue : values[index] * scale + offset;
+        }
+        return;
+    }
+    vDSP_vsmsaD(values, 1, &scale, &offset, canvasValues, 1, (vDSP_Length)count);
+    for (long index = 0; index < count; index++) {
+        canvasValues[index] = (values[index] == SFGraphKernelUnsetValue) ? unsetCanvasValue : canvasValues[index];
+    }
+#else
+    long index = 0;
+#if SF_GRAPH_KERNELS_VECTOR_EXTENSIONS
+    const SFDouble2 unsetValues = SFDouble2Splat(SFGraphKernelUnsetValue);
+    const SFDouble2 unsetCanvasValues = SFDouble2Splat(unsetCanvasValue);
+    const SFDouble2 scales = SFDouble2Splat(scale);
+    const SFDouble2 offsets = SFDouble2Splat(offset);
+    for (; index + 2 <= count; index += 2) {
+        SFDouble2 vector = SFDouble2Load(values + index);
+        SFMask2 unsetMask = (SFMask2)(vector == unsetValues);
+        SFDouble2Store(canvasValues + index, SFDouble2Select(unsetMask, unsetCanvasValues, vector * scales + offsets));
+    }
+#endif
+    for (; index < count; index++) {
+        canvasValues[index] = (values[index] == SFGraphKernelUnsetValue) ? unsetCanvasValue : values[index] * scale + offset;
+    }
+#endif
+}
+
+void SFGraphKernelMapToCanvasX(const double *values, double *canvasValues, long count,
+                               double minimumValue, double maximumValue, double canvasWidth) {
+    if (count <= 0) {
+        return;
+    }
+    
+    // (value - minimumValue) / (maximumValue - minimumValue) * canvasWidth, as value * scale + offset
+    double scale = 0;
+    double offset = 0;
+    if (minimumValue != maximumValue) {
+        scale = canvasWidth / (maximumValue - minimumValue);
+        offset = -minimumValue * scale;
+    }
+    
+#if SF_GRAPH_KERNELS_ACCELERATE
+    vDSP_vsmsaD(values, 1, &scale, &offset, canvasValues, 1, (vDSP_Length)count);
+#else
+    long index = 0;
+#if SF_GRAPH_KERNELS_VECTOR_EXTENSIONS
+    const SFDouble2 scales = SFDouble2Splat(scale);
+    const SFDouble2 offsets = SFDouble2Splat(offset);
+    for (; index + 2 <= count; index += 2) {
+        SFDouble2Store(canvasValues + index, SFDouble2Load(values + index) * scales + offsets);
+    }
+#endif
+    for (; index < count; index++) {
+        canvasValues[index] = values[index] * scale + offset;
+    }
+#endif
+}
+
+void SFGraphKernelFloor(double *values, long count) {
+    if (count <= 0) {
+        return;
+    }
+#if SF_GRAPH_KERNELS_ACCELERATE
+    int intCount = (int)count;
+    vvfloor(values, values, &intCount);
+#else
+    for (long index = 0; index < count; index++) {
+        values[index] = floor(values[index]);
+    }
+#endif
+}
+
+void SFGraphKernelPrefixSum(const double *values, double *sums, long count) {
+    // Every sum depends on the previous one, and value stacks are short, so this stays a scalar loop
+    double sum = 0;
+    for (long index = 0; index < count; index++) {
+        sum += values[index];
+        sums[index] = sum;
+    }
+}
@@ -0,0 +1,60 @@
+//
+//  SFGraphChartKernels.h
+//  SFKit
+//
+//  Created by David Moore on 10/17/26.
+//  Copyright © 2026 Moore Development. All rights reserved.
+//
+
+#ifndef SFGraphChartKernels_h
+#define SFGraphChartKernels_h
+
+#include <float.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ Kernels over the contiguous value buffers of graph chart plots.
+ 
+ Unset values are stored as `SFGraphKernelUnsetValue`, which matches `SFDoubleInvalidValue`, and
+ act as a mask: reductions skip them and the canvas mapping writes a caller-provided value in their
+ place. The kernels use Accelerate on Apple platforms and GCC/Clang vector extensions elsewhere,
+ falling back to scalar loops on other compilers. They only depend on the C standard library.
+ */
+#define SFGraphKernelUnsetValue DBL_MAX
+
+/// Returns the lowest value that is set, or `SFGraphKernelUnsetValue` if every value is unset.
+double SFGraphKernelMinimum(const double *values, long count);
+
+/// Returns the highest value that is set, or `SFGraphKernelUnsetValue` if every value is unset.
+double SFGraphKernelMaximum(const double *values, long count);
+
+/**
+ Maps `values` to canvas y-coordinates, so `minimumValue` maps to `canvasHeight` and `maximumValue`
+ maps to 0. Every value maps to half the canvas height if both limits are equal. Unset values map to
+ `unsetCanvasValue`. `canvasValues` may alias `values`.
+ */
+void SFGraphKernelMapToCanvas(const double *values, double *canvasValues, long count,
+                              double minimumValue, double maximumValue, double canvasHeight,
+                              double unsetCanvasValue);
+
+/**
+ Maps sorted x values to canvas x-coordinates, so `minimumValue` maps to 0 and `maximumValue` maps to
+ `canvasWidth`. Every value maps to 0 if both limits are equal. `canvasValues` may alias `values`.
+ */
+void SFGraphKernelMapToCanvasX(const double *values, double *canvasValues, long count,
+                               double minimumValue, double maximumValue, double canvasWidth);
+
+/// Rounds each value down to an integral value in place.
+void SFGraphKernelFloor(double *values, long count);
+
+/// Writes the running sums of `values` to `sums`, which may alias `values`.
+void SFGraphKernelPrefixSum(const double *values, double *sums, long count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SFGraphChartKernels_h */
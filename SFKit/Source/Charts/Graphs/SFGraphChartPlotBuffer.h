@@ -0,0 +1,198 @@
+//
+//  SFGraphChartPlotBuffer.h
+//  SFKit
+//
+//  Created by David Moore on 10/17/26.
+//  Copyright © 2026 Moore Development. All rights reserved.
+//
+
+@import Foundation;
+#import "SFHelpers_Internal.h"
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class SFValueStack;
+
+SF_INLINE BOOL SFGraphValueIsUnset(double minimumValue, double maximumValue) {
+    return (minimumValue == SFDoubleInvalidValue && maximumValue == SFDoubleInvalidValue);
+}
+
+/**
+ The `SFGraphChartPlotBuffer` class stores the values of a single graph chart plot in contiguous
+ `double` buffers, one per column, instead of one `SFValueRange` or `SFValueStack` object per point.
+
+ Value ranges are stored in `minimumValues` and `maximumValues`. Value stacks additionally store
+ their stacked values in a flat `stackValues` buffer along with their running sums in `stackSums`;
+ the stacked values of the point at `index` occupy the `[stackOffsets[index], stackOffsets[index + 1])`
+ range of both buffers. The minimum and maximum value of a value stack are both its total value.
+
+ The canvas buffers hold the values normalized to the plot view height. They are reused across
+ layout passes and are considered stale whenever the stored values change.
+ 
+ While streaming, the buffer keeps a sliding window of the most recent `windowSize` value ranges in
+ storage for twice as many values. Streamed values are written after the window and the window start
+ advances, so the value pointers always address a contiguous window. The window is moved back to the
+ start of the storage once it reaches its end, making each streamed value cost amortized O(1).
+ 
+ The extrema of any range of values are answered in O(log n) by a segment tree over the storage,
+ holding the lowest minimum value, the highest maximum value and the number of unset values of each
+ node. The tree is built on the first range query and updated in place as values are appended, set,
+ replaced or streamed; removing or inserting values rebuilds it on the next range query.
+ 
+ The nearest valid values around any index are answered in O(1) from a pair of tables holding the
+ storage index of the next and previous valid value of each stored value. The tables are built on the
+ first lookup and extended as values are appended or streamed; any other change rebuilds them on the
+ next lookup.
+ */
+@interface SFGraphChartPlotBuffer : NSObject
+
+- (instancetype)initWithCapacity:(NSInteger)capacity NS_DESIGNATED_INITIALIZER;
+
+@property (nonatomic, readonly) NSInteger count;
+
+@property (nonatomic, readonly) NSInteger numberOfValidValues;
+
+@property (nonatomic, readonly) double *minimumValues;
+
+@property (nonatomic, readonly) double *maximumValues;
+
+@property (nonatomic, readonly) double *canvasMinimumValues; // Normalized for the plot view height
+
+@property (nonatomic, readonly) double *canvasMaximumValues; // Normalized for the plot view height
+
+@property (nonatomic, readonly, nullable) NSInteger *stackOffsets; // NULL until a value stack is appended
+
+@property (nonatomic, readonly, nullable) double *stackValues;
+
+@property (nonatomic, readonly, nullable) double *stackSums;
+
+@property (nonatomic, readonly, nullable) double *canvasStackSums; // Normalized for the plot view height
+
+@property (nonatomic, readonly, nullable) double *xValues; // Sorted x values of each point, NULL until x values are stored
+
+@property (nonatomic) BOOL hasCanvasValues;
+
+@property (nonatomic) NSRange canvasValuesRange; // Indexes whose canvas values are up to date when hasCanvasValues is YES
+
+@property (nonatomic, readonly) NSInteger numberOfPaddingValues; // Trailing unset values up to the number of x axis points
+
+@property (nonatomic, readonly) NSInteger windowSize; // 0 unless streaming
+
+@property (nonatomic, readonly, nullable) NSInteger *sampledIndexes; // Ascending indexes of the values kept by downsampling
+
+@property (nonatomic, readonly, nullable) BOOL *sampledIndexesFollowGaps; // Whether unset values precede each sampled index
+
+@property (nonatomic, readonly) NSInteger numberOfSampledIndexes;
+
+- (void)removeAllValues;
+
+- (void)appendMinimumValue:(double)minimumValue maximumValue:(double)maximumValue;
+
+- (void)appendValueStack:(SFValueStack *)valueStack;
+
+- (void)appendUnsetValuesWithCount:(NSInteger)count;
+
+/**
+ Appends unset values until the buffer holds `count` values. The appended values are tracked as
+ padding so `removePaddingValues` can restore the values obtained from the data source. Padding
+ values repeat the last x value, keeping the x values sorted.
+ */
+- (void)padWithUnsetValuesToCount:(NSInteger)count;
+
+- (void)removePaddingValues;
+
+/**
+ Appends `count` value ranges written in place by `fillBlock`, which receives the minimum and
+ maximum value buffers positioned at the first appended index.
+ */
+- (void)appendValuesWithCount:(NSInteger)count fillBlock:(NS_NOESCAPE void (^)(double *minimumValues, double *maximumValues))fillBlock;
+
+/**
+ Removes the values at the specified indexes, compacting the remaining values and their stacked
+ values in a single pass.
+ */
+- (void)removeValuesAtIndexes:(NSIndexSet *)indexes;
+
+/**
+ Inserts unset values at the specified indexes, which refer to the positions of the inserted
+ values once the insertion is complete.
+ */
+- (void)insertUnsetValuesAtIndexes:(NSIndexSet *)indexes;
+
+- (void)setMinimumValue:(double)minimumValue maximumValue:(double)maximumValue atIndex:(NSInteger)index;
+
+- (void)setValueStack:(SFValueStack *)valueStack atIndex:(NSInteger)index;
+
+/**
+ Replaces the value ranges in `range` with the values written in place by `fillBlock`, which
+ receives the minimum and maximum value buffers positioned at `range.location`.
+ */
+- (void)replaceValuesInRange:(NSRange)range fillBlock:(NS_NOESCAPE void (^)(double *minimumValues, double *maximumValues))fillBlock;
+
+/**
+ Replaces the x values in `range` with the values written in place by `fillBlock`, which receives
+ the x value buffer positioned at `range.location`. The x value buffer is allocated on first use;
+ until then, and for values appended or inserted afterwards, x values are NaN.
+ */
+- (void)replaceXValuesInRange:(NSRange)range fillBlock:(NS_NOESCAPE void (^)(double *xValues))fillBlock;
+
+/**
+ Starts streaming, keeping only the most recent `windowSize` value ranges. Value stacks and x
+ values cannot be streamed. While streaming, value ranges can still be set or replaced in place, but
+ appending, removing or inserting values outside of streaming throws an exception. Streaming ends
+ when all the values are removed.
+ */
+- (void)beginStreamingWithWindowSize:(NSInteger)windowSize;
+
+/**
+ Appends a value range while streaming, evicting the oldest value range if the window is full. The
+ canvas values of the appended value range are left for the caller to fill.
+ 
+ @return `YES` if the oldest value range was evicted.
+ */
+- (BOOL)streamMinimumValue:(double)minimumValue maximumValue:(double)maximumValue;
+
+/**
+ Downsamples the values in `range` by keeping the indexes of the lowest minimum value and highest
+ maximum value within each of `numberOfBuckets` equally sized buckets, which preserves the visual
+ extremes of the values once each bucket spans a pixel column. The first and last valid values of
+ the range are always kept. Each bucket is resolved from the range
+ extrema tree in O(log n), so the cost follows the number of buckets rather than the number of values.
+ */
+- (void)sampleExtremaInRange:(NSRange)range numberOfBuckets:(NSInteger)numberOfBuckets;
+
+/**
+ Normalizes the values in `range` to a plot view of `canvasHeight` spanning `minimumValue` to
+ `maximumValue`: the running sums of the value stacks when the buffer holds value stacks, and the
+ value ranges otherwise. Only the buffer is read and written, so a buffer which is not displayed yet
+ can be normalized off the main thread.
+ */
+- (void)normalizeCanvasValuesInRange:(NSRange)range
+                        minimumValue:(double)minimumValue
+                        maximumValue:(double)maximumValue
+                        canvasHeight:(CGFloat)canvasHeight;
+
+- (BOOL)hasCanvasValuesInRange:(NSRange)range;
+
+/// The lowest valid minimum value in `range`, or `SFDoubleInvalidValue` if every value is unset.
+- (double)minimumValueInRange:(NSRange)range;
+
+/// The highest valid maximum value in `range`, or `SFDoubleInvalidValue` if every value is unset.
+- (double)maximumValueInRange:(NSRange)range;
+
+- (NSInteger)numberOfUnsetValuesInRange:(NSRange)range;
+
+- (BOOL)isUnsetAtIndex:(NSInteger)index;
+
+/// The index of the first valid value at or after `index`, or `NSNotFound` if every value from `index` on is unset.
+- (NSInteger)indexOfValidValueAtOrAfterIndex:(NSInteger)index;
+
+/// The index of the last valid value at or before `index`, or `NSNotFound` if every value up to `index` is unset.
+- (NSInteger)indexOfValidValueAtOrBeforeIndex:(NSInteger)index;
+
+- (NSInteger)numberOfStackedValuesAtIndex:(NSInteger)index;
+
+@end
+
+NS_ASSUME_NONNULL_END
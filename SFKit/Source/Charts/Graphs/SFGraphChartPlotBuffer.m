@@ -0,0 +1,811 @@
+//
+//  SFGraphChartPlotBuffer.m
+//  SFKit
+//
+//  Created by David Moore on 10/17/26.
+//  Copyright © 2026 Moore Development. All rights reserved.
+//
+
+#import "SFGraphChartPlotBuffer.h"
+#import "SFGraphChartKernels.h"
+
+#import "SFChartTypes.h"
+
+
+static void *SFReallocBuffer(void *buffer, NSInteger count, size_t elementSize) {
+    void *reallocatedBuffer = realloc(buffer, MAX(count, 1) * elementSize);
+    if (!reallocatedBuffer) {
+        @throw [NSException exceptionWithName:NSMallocException
+                                       reason:@"SFGraphChartPlotBuffer could not allocate its value buffers"
+                                     userInfo:nil];
+    }
+    return reallocatedBuffer;
+}
+
+// Searches the subtree of node, spanning the [nodeStart, nodeEnd) leaves, for the first leaf in
+// [start, end) holding value, pruning the subtrees whose extremum cannot be value
+static NSInteger SFExtremaTreeFirstLeafWithValue(const double *tree, BOOL isMinimumTree, double value,
+                                                 NSInteger node, NSInteger nodeStart, NSInteger nodeEnd,
+                                                 NSInteger start, NSInteger end) {
+    if (nodeEnd <= start || nodeStart >= end || (isMinimumTree ? tree[node] > value : tree[node] < value)) {
+        return NSNotFound;
+    }
+    if (nodeEnd - nodeStart == 1) {
+        return nodeStart;
+    }
+    NSInteger middle = nodeStart + (nodeEnd - nodeStart) / 2;
+    NSInteger leaf = SFExtremaTreeFirstLeafWithValue(tree, isMinimumTree, value, 2 * node, nodeStart, middle, start, end);
+    if (leaf == NSNotFound) {
+        leaf = SFExtremaTreeFirstLeafWithValue(tree, isMinimumTree, value, 2 * node + 1, middle, nodeEnd, start, end);
+    }
+    return leaf;
+}
+
+@implementation SFGraphChartPlotBuffer {
+    NSInteger _capacity;
+    NSInteger _stackCapacity;
+    NSInteger _windowStartIndex; // Storage index of the first value while streaming
+    NSInteger _sampledCapacity;
+    double *_treeMinimumValues; // Segment tree nodes, the root at index 1 and the leaves from _treeLeafCount
+    double *_treeMaximumValues; // -INFINITY rather than SFDoubleInvalidValue for unset values
+    NSInteger *_treeUnsetCounts;
+    NSInteger _treeLeafCount;
+    BOOL _hasExtremaTree;
+    NSInteger *_nextValidIndexes; // Storage index of the next valid value at or after each storage index, or -1
+    NSInteger *_previousValidIndexes; // Storage index of the previous valid value at or before each storage index, or -1
+    NSInteger _validIndexTableCapacity;
+    BOOL _hasValidIndexTables;
+}
+
+- (instancetype)init {
+    return [self initWithCapacity:0];
+}
+
+- (instancetype)initWithCapacity:(NSInteger)capacity {
+    self = [super init];
+    if (self) {
+        [self reserveCapacity:MAX(capacity, 1)];
+    }
+    return self;
+}
+
+- (void)dealloc {
+    free(_minimumValues);
+    free(_maximumValues);
+    free(_canvasMinimumValues);
+    free(_canvasMaximumValues);
+    free(_stackOffsets);
+    free(_stackValues);
+    free(_stackSums);
+    free(_canvasStackSums);
+    free(_xValues);
+    free(_sampledIndexes);
+    free(_sampledIndexesFollowGaps);
+    free(_treeMinimumValues);
+    free(_treeMaximumValues);
+    free(_treeUnsetCounts);
+    free(_nextValidIndexes);
+    free(_previousValidIndexes);
+}
+
+#pragma mark - Accessors
+
+- (double *)minimumValues {
+    return _minimumValues + _windowStartIndex;
+}
+
+- (double *)maximumValues {
+    return _maximumValues + _windowStartIndex;
+}
+
+- (double *)canvasMinimumValues {
+    return _canvasMinimumValues + _windowStartIndex;
+}
+
+- (double *)canvasMaximumValues {
+    return _canvasMaximumValues + _windowStartIndex;
+}
+
+#pragma mark - Storage
+
+- (void)reserveCapacity:(NSInteger)capacity {
+    if (capacity <= _capacity) {
+        return;
+    }
+    _minimumValues = SFReallocBuffer(_minimumValues, capacity, sizeof(double));
+    _maximumValues = SFReallocBuffer(_maximumValues, capacity, sizeof(double));
+    _canvasMinimumValues = SFReallocBuffer(_canvasMinimumValues, capacity, sizeof(double));
+    _canvasMaximumValues = SFReallocBuffer(_canvasMaximumValues, capacity, sizeof(double));
+    if (_stackOffsets) {
+        _stackOffsets = SFReallocBuffer(_stackOffsets, capacity + 1, sizeof(NSInteger));
+    }
+    if (_xValues) {
+        _xValues = SFReallocBuffer(_xValues, capacity, sizeof(double));
+    }
+    _capacity = capacity;
+    _hasExtremaTree = NO; // The tree leaves span the storage
+    _hasValidIndexTables = NO;
+}
+
+- (void)reserveStackCapacity:(NSInteger)stackCapacity {
+    if (!_stackOffsets) {
+        // Points appended before the first value stack have no stacked values
+        _stackOffsets = calloc(_capacity + 1, sizeof(NSInteger));
+        if (!_stackOffsets) {
+            @throw [NSException exceptionWithName:NSMallocException
+                                           reason:@"SFGraphChartPlotBuffer could not allocate its value buffers"
+                                         userInfo:nil];
+        }
+    }
+    if (stackCapacity <= _stackCapacity) {
+        return;
+    }
+    stackCapacity = MAX(stackCapacity, _stackCapacity * 2);
+    _stackValues = SFReallocBuffer(_stackValues, stackCapacity, sizeof(double));
+    _stackSums = SFReallocBuffer(_stackSums, stackCapacity, sizeof(double));
+    _canvasStackSums = SFReallocBuffer(_canvasStackSums, stackCapacity, sizeof(double));
+    _stackCapacity = stackCapacity;
+}
+
+- (void)throwIfStreamingForSelector:(SEL)selector {
+    // Only the value ranges of a streaming window can change in place; its layout is owned by
+    // streamMinimumValue:maximumValue:
+    if (_windowSize > 0) {
+        @throw [NSException exceptionWithName:NSInternalInconsistencyException
+                                       reason:[NSString stringWithFormat:@"%@ is not available while streaming", NSStringFromSelector(selector)]
+                                     userInfo:nil];
+    }
+}
+
+- (void)growIfNeededForCount:(NSInteger)count {
+    if (count > _capacity) {
+        [self reserveCapacity:MAX(count, _capacity * 2)];
+    }
+}
+
+#pragma mark - Values
+
+- (void)removeAllValues {
+    _count = 0;
+    _numberOfValidValues = 0;
+    _numberOfPaddingValues = 0;
+    _windowSize = 0;
+    _windowStartIndex = 0;
+    _numberOfSampledIndexes = 0;
+    _hasCanvasValues = NO;
+    _hasExtremaTree = NO;
+    _hasValidIndexTables = NO;
+    if (_stackOffsets) {
+        _stackOffsets[0] = 0;
+    }
+}
+
+- (void)appendMinimumValue:(double)minimumValue maximumValue:(double)maximumValue {
+    [self throwIfStreamingForSelector:_cmd];
+    [self growIfNeededForCount:_count + 1];
+    _minimumValues[_count] = minimumValue;
+    _maximumValues[_count] = maximumValue;
+    if (_stackOffsets) {
+        _stackOffsets[_count + 1] = _stackOffsets[_count];
+    }
+    if (_xValues) {
+        _xValues[_count] = NAN;
+    }
+    if (!SFGraphValueIsUnset(minimumValue, maximumValue)) {
+        _numberOfValidValues++;
+    }
+    [self updateExtremaTreeInStorageRange:NSMakeRange(_count, 1)];
+    [self updateValidIndexTablesForAppendedStorageIndex:_count];
+    _count++;
+    _hasCanvasValues = NO;
+}
+
+- (void)appendValueStack:(SFValueStack *)valueStack {
+    NSArray<NSNumber *> *stackedValues = valueStack.stackedValues;
+    NSInteger numberOfStackedValues = stackedValues.count;
+    [self reserveStackCapacity:(_stackOffsets ? _stackOffsets[_count] : 0) + numberOfStackedValues];
+
+    NSInteger stackIndex = _stackOffsets[_count];
+    for (NSNumber *value in stackedValues) {
+        _stackValues[stackIndex++] = value.doubleValue;
+    }
+    SFGraphKernelPrefixSum(_stackValues + stackIndex - numberOfStackedValues, _stackSums + stackIndex - numberOfStackedValues, numberOfStackedValues);
+    double sum = (numberOfStackedValues > 0) ? _stackSums[stackIndex - 1] : 0;
+
+    double totalValue = valueStack.isUnset ? SFDoubleInvalidValue : sum;
+    [self appendMinimumValue:totalValue maximumValue:totalValue];
+    _stackOffsets[_count] = stackIndex;
+}
+
+- (void)appendUnsetValuesWithCount:(NSInteger)count {
+    [self growIfNeededForCount:_count + count];
+    for (NSInteger index = 0; index < count; index++) {
+        [self appendMinimumValue:SFDoubleInvalidValue maximumValue:SFDoubleInvalidValue];
+    }
+}
+
+- (void)padWithUnsetValuesToCount:(NSInteger)count {
+    NSInteger numberOfPaddingValues = count - _count;
+    if (numberOfPaddingValues > 0) {
+        NSInteger paddingStartIndex = _count;
+        [self appendUnsetValuesWithCount:numberOfPaddingValues];
+        _numberOfPaddingValues += numberOfPaddingValues;
+        if (_xValues) {
+            double lastXValue = (paddingStartIndex > 0) ? _xValues[paddingStartIndex - 1] : 0;
+            for (NSInteger index = paddingStartIndex; index < count; index++) {
+                _xValues[index] = lastXValue;
+            }
+        }
+    }
+}
+
+- (void)removePaddingValues {
+    if (_numberOfPaddingValues > 0) {
+        // Padding values are unset and hold no stacked values
+        _count -= _numberOfPaddingValues;
+        _numberOfPaddingValues = 0;
+        _hasCanvasValues = NO;
+    }
+}
+
+- (void)appendValuesWithCount:(NSInteger)count fillBlock:(NS_NOESCAPE void (^)(double *minimumValues, double *maximumValues))fillBlock {
+    if (count <= 0) {
+        return;
+    }
+    [self throwIfStreamingForSelector:_cmd];
+    [self growIfNeededForCount:_count + count];
+    fillBlock(_minimumValues + _count, _maximumValues + _count);
+    
+    NSInteger endIndex = _count + count;
+    for (NSInteger index = _count; index < endIndex; index++) {
+        if (!SFGraphValueIsUnset(_minimumValues[index], _maximumValues[index])) {
+            _numberOfValidValues++;
+        }
+        if (_stackOffsets) {
+            _stackOffsets[index + 1] = _stackOffsets[index];
+        }
+        if (_xValues) {
+            _xValues[index] = NAN;
+        }
+        [self updateValidIndexTablesForAppendedStorageIndex:index];
+    }
+    [self updateExtremaTreeInStorageRange:NSMakeRange(_count, count)];
+    _count = endIndex;
+    _hasCanvasValues = NO;
+}
+
+- (void)removeValuesAtIndexes:(NSIndexSet *)indexes {
+    if (indexes.count == 0) {
+        return;
+    }
+    [self throwIfStreamingForSelector:_cmd];
+    if (indexes.lastIndex >= (NSUInteger)_count) {
+        @throw [NSException exceptionWithName:NSRangeException
+                                       reason:[NSString stringWithFormat:@"Index %lu beyond bounds [0 .. %ld]", (unsigned long)indexes.lastIndex, (long)_count - 1]
+                                     userInfo:nil];
+    }
+    
+    NSInteger writeIndex = indexes.firstIndex;
+    NSInteger stackWriteIndex = _stackOffsets ? _stackOffsets[writeIndex] : 0;
+    for (NSInteger readIndex = writeIndex; readIndex < _count; readIndex++) {
+        if ([indexes containsIndex:readIndex]) {
+            if (!SFGraphValueIsUnset(_minimumValues[readIndex], _maximumValues[readIndex])) {
+                _numberOfValidValues--;
+            }
+            continue;
+        }
+        _minimumValues[writeIndex] = _minimumValues[readIndex];
+        _maximumValues[writeIndex] = _maximumValues[readIndex];
+        if (_xValues) {
+            _xValues[writeIndex] = _xValues[readIndex];
+        }
+        if (_stackOffsets) {
+            // Offsets at or after readIndex have not been overwritten yet
+            NSInteger stackReadIndex = _stackOffsets[readIndex];
+            NSInteger numberOfStackedValues = _stackOffsets[readIndex + 1] - stackReadIndex;
+            memmove(_stackValues + stackWriteIndex, _stackValues + stackReadIndex, numberOfStackedValues * sizeof(double));
+            memmove(_stackSums + stackWriteIndex, _stackSums + stackReadIndex, numberOfStackedValues * sizeof(double));
+            _stackOffsets[writeIndex] = stackWriteIndex;
+            stackWriteIndex += numberOfStackedValues;
+        }
+        writeIndex++;
+    }
+    _count = writeIndex;
+    if (_stackOffsets) {
+        _stackOffsets[_count] = stackWriteIndex;
+    }
+    _hasCanvasValues = NO;
+    _hasExtremaTree = NO;
+    _hasValidIndexTables = NO;
+}
+
+- (void)insertUnsetValuesAtIndexes:(NSIndexSet *)indexes {
+    NSInteger numberOfInsertedValues = indexes.count;
+    if (numberOfInsertedValues == 0) {
+        return;
+    }
+    [self throwIfStreamingForSelector:_cmd];
+    NSInteger count = _count + numberOfInsertedValues;
+    if (indexes.lastIndex >= (NSUInteger)count) {
+        @throw [NSException exceptionWithName:NSRangeException
+                                       reason:[NSString stringWithFormat:@"Index %lu beyond bounds [0 .. %ld]", (unsigned long)indexes.lastIndex, (long)count - 1]
+                                     userInfo:nil];
+    }
+    [self growIfNeededForCount:count];
+    
+    // Move the values back to front so nothing is overwritten before it is read. Unset values hold
+    // no stacked values, so only the stack offsets move.
+    NSInteger readIndex = _count - 1;
+    NSInteger stackEndIndex = _stackOffsets ? _stackOffsets[_count] : 0;
+    for (NSInteger writeIndex = count - 1; writeIndex >= (NSInteger)indexes.firstIndex; writeIndex--) {
+        NSInteger stackStartIndex = stackEndIndex;
+        if ([indexes containsIndex:writeIndex]) {
+            _minimumValues[writeIndex] = _maximumValues[writeIndex] = SFDoubleInvalidValue;
+            if (_xValues) {
+                _xValues[writeIndex] = NAN;
+            }
+        } else {
+            _minimumValues[writeIndex] = _minimumValues[readIndex];
+            _maximumValues[writeIndex] = _maximumValues[readIndex];
+            if (_xValues) {
+                _xValues[writeIndex] = _xValues[readIndex];
+            }
+            if (_stackOffsets) {
+                stackStartIndex = _stackOffsets[readIndex];
+            }
+            readIndex--;
+        }
+        if (_stackOffsets) {
+            _stackOffsets[writeIndex + 1] = stackEndIndex;
+        }
+        stackEndIndex = stackStartIndex;
+    }
+    _count = count;
+    _hasCanvasValues = NO;
+    _hasExtremaTree = NO;
+    _hasValidIndexTables = NO;
+}
+
+- (void)setMinimumValue:(double)minimumValue maximumValue:(double)maximumValue atIndex:(NSInteger)index {
+    if ([self isUnsetAtIndex:index] != SFGraphValueIsUnset(minimumValue, maximumValue)) {
+        _numberOfValidValues += SFGraphValueIsUnset(minimumValue, maximumValue) ? -1 : 1;
+        // A value becoming valid or unset changes the neighbors of the whole gap around it
+        _hasValidIndexTables = NO;
+    }
+    NSInteger storageIndex = _windowStartIndex + index;
+    _minimumValues[storageIndex] = minimumValue;
+    _maximumValues[storageIndex] = maximumValue;
+    [self updateExtremaTreeInStorageRange:NSMakeRange(storageIndex, 1)];
+    _hasCanvasValues = NO;
+}
+
+- (void)setValueStack:(SFValueStack *)valueStack atIndex:(NSInteger)index {
+    NSArray<NSNumber *> *stackedValues = valueStack.stackedValues;
+    NSInteger numberOfStackedValues = stackedValues.count;
+    [self reserveStackCapacity:(_stackOffsets ? _stackOffsets[_count] : 0) + numberOfStackedValues];
+    
+    // Make room for the new stacked values by shifting the stacked values of the following points
+    NSInteger stackStartIndex = _stackOffsets[index];
+    NSInteger stackEndIndex = _stackOffsets[index + 1];
+    NSInteger delta = numberOfStackedValues - (stackEndIndex - stackStartIndex);
+    if (delta != 0) {
+        NSInteger numberOfTrailingValues = _stackOffsets[_count] - stackEndIndex;
+        memmove(_stackValues + stackEndIndex + delta, _stackValues + stackEndIndex, numberOfTrailingValues * sizeof(double));
+        memmove(_stackSums + stackEndIndex + delta, _stackSums + stackEndIndex, numberOfTrailingValues * sizeof(double));
+        for (NSInteger offsetIndex = index + 1; offsetIndex <= _count; offsetIndex++) {
+            _stackOffsets[offsetIndex] += delta;
+        }
+    }
+    
+    NSInteger stackIndex = stackStartIndex;
+    for (NSNumber *value in stackedValues) {
+        _stackValues[stackIndex++] = value.doubleValue;
+    }
+    SFGraphKernelPrefixSum(_stackValues + stackIndex - numberOfStackedValues, _stackSums + stackIndex - numberOfStackedValues, numberOfStackedValues);
+    double sum = (numberOfStackedValues > 0) ? _stackSums[stackIndex - 1] : 0;
+    
+    double totalValue = valueStack.isUnset ? SFDoubleInvalidValue : sum;
+    [self setMinimumValue:totalValue maximumValue:totalValue atIndex:index];
+}
+
+- (void)replaceValuesInRange:(NSRange)range fillBlock:(NS_NOESCAPE void (^)(double *minimumValues, double *maximumValues))fillBlock {
+    NSInteger endIndex = NSMaxRange(range);
+    for (NSInteger index = range.location; index < endIndex; index++) {
+        if (![self isUnsetAtIndex:index]) {
+            _numberOfValidValues--;
+        }
+    }
+    NSInteger storageIndex = _windowStartIndex + range.location;
+    fillBlock(_minimumValues + storageIndex, _maximumValues + storageIndex);
+    for (NSInteger index = range.location; index < endIndex; index++) {
+        if (![self isUnsetAtIndex:index]) {
+            _numberOfValidValues++;
+        }
+    }
+    [self updateExtremaTreeInStorageRange:NSMakeRange(storageIndex, range.length)];
+    _hasCanvasValues = NO;
+    _hasValidIndexTables = NO;
+}
+
+- (void)replaceXValuesInRange:(NSRange)range fillBlock:(NS_NOESCAPE void (^)(double *xValues))fillBlock {
+    if (NSMaxRange(range) > (NSUInteger)_count) {
+        @throw [NSException exceptionWithName:NSRangeException
+                                       reason:[NSString stringWithFormat:@"Range %@ beyond bounds [0 .. %ld]", NSStringFromRange(range), (long)_count - 1]
+                                     userInfo:nil];
+    }
+    [self throwIfStreamingForSelector:_cmd];
+    if (!_xValues) {
+        _xValues = SFReallocBuffer(NULL, _capacity, sizeof(double));
+        for (NSInteger index = 0; index < _capacity; index++) {
+            _xValues[index] = NAN;
+        }
+    }
+    fillBlock(_xValues + range.location);
+}
+
+#pragma mark - Streaming
+
+- (void)beginStreamingWithWindowSize:(NSInteger)windowSize {
+    if (windowSize <= 0) {
+        @throw [NSException exceptionWithName:NSInvalidArgumentException
+                                       reason:@"windowSize must be greater than 0"
+                                     userInfo:nil];
+    }
+    if (_stackOffsets) {
+        @throw [NSException exceptionWithName:NSInternalInconsistencyException
+                                       reason:@"Value stacks cannot be streamed"
+                                     userInfo:nil];
+    }
+    if (_xValues) {
+        @throw [NSException exceptionWithName:NSInternalInconsistencyException
+                                       reason:@"X values cannot be streamed"
+                                     userInfo:nil];
+    }
+    
+    [self removePaddingValues];
+    if (_count > windowSize) {
+        [self removeValuesAtIndexes:[NSIndexSet indexSetWithIndexesInRange:NSMakeRange(0, _count - windowSize)]];
+    }
+    [self reserveCapacity:2 * windowSize];
+    _windowSize = windowSize;
+}
+
+- (BOOL)streamMinimumValue:(double)minimumValue maximumValue:(double)maximumValue {
+    BOOL evicted = NO;
+    if (_count == _windowSize) {
+        if (!SFGraphValueIsUnset(_minimumValues[_windowStartIndex], _maximumValues[_windowStartIndex])) {
+            _numberOfValidValues--;
+        }
+        _windowStartIndex++;
+        _count--;
+        evicted = YES;
+    }
+    if (_windowStartIndex + _count == _capacity) {
+        // Move the window back to the start of the storage, once every windowSize values
+        size_t windowLength = _count * sizeof(double);
+        memmove(_minimumValues, _minimumValues + _windowStartIndex, windowLength);
+        memmove(_maximumValues, _maximumValues + _windowStartIndex, windowLength);
+        memmove(_canvasMinimumValues, _canvasMinimumValues + _windowStartIndex, windowLength);
+        memmove(_canvasMaximumValues, _canvasMaximumValues + _windowStartIndex, windowLength);
+        _windowStartIndex = 0;
+        _hasExtremaTree = NO;
+        _hasValidIndexTables = NO;
+    }
+    
+    NSInteger index = _windowStartIndex + _count;
+    _minimumValues[index] = minimumValue;
+    _maximumValues[index] = maximumValue;
+    if (!SFGraphValueIsUnset(minimumValue, maximumValue)) {
+        _numberOfValidValues++;
+    }
+    [self updateExtremaTreeInStorageRange:NSMakeRange(index, 1)];
+    [self updateValidIndexTablesForAppendedStorageIndex:index];
+    _count++;
+    return evicted;
+}
+
+#pragma mark - Range Extrema
+
+- (void)buildExtremaTreeIfNeeded {
+    if (_hasExtremaTree) {
+        return;
+    }
+    NSInteger leafCount = 1;
+    while (leafCount < _capacity) {
+        leafCount *= 2;
+    }
+    if (leafCount != _treeLeafCount) {
+        _treeMinimumValues = SFReallocBuffer(_treeMinimumValues, 2 * leafCount, sizeof(double));
+        _treeMaximumValues = SFReallocBuffer(_treeMaximumValues, 2 * leafCount, sizeof(double));
+        _treeUnsetCounts = SFReallocBuffer(_treeUnsetCounts, 2 * leafCount, sizeof(NSInteger));
+        _treeLeafCount = leafCount;
+    }
+    
+    // Leaves outside of the stored values are empty
+    for (NSInteger node = leafCount; node < 2 * leafCount; node++) {
+        _treeMinimumValues[node] = SFDoubleInvalidValue;
+        _treeMaximumValues[node] = -INFINITY;
+        _treeUnsetCounts[node] = 0;
+    }
+    [self setExtremaTreeLeavesInStorageRange:NSMakeRange(_windowStartIndex, _count)];
+    for (NSInteger node = leafCount - 1; node > 0; node--) {
+        [self updateExtremaTreeNode:node];
+    }
+    _hasExtremaTree = YES;
+}
+
+- (void)updateExtremaTreeNode:(NSInteger)node {
+    _treeMinimumValues[node] = MIN(_treeMinimumValues[2 * node], _treeMinimumValues[2 * node + 1]);
+    _treeMaximumValues[node] = MAX(_treeMaximumValues[2 * node], _treeMaximumValues[2 * node + 1]);
+    _treeUnsetCounts[node] = _treeUnsetCounts[2 * node] + _treeUnsetCounts[2 * node + 1];
+}
+
+- (void)setExtremaTreeLeavesInStorageRange:(NSRange)range {
+    for (NSInteger storageIndex = range.location; storageIndex < NSMaxRange(range); storageIndex++) {
+        NSInteger node = _treeLeafCount + storageIndex;
+        BOOL isUnset = SFGraphValueIsUnset(_minimumValues[storageIndex], _maximumValues[storageIndex]);
+        _treeMinimumValues[node] = isUnset ? SFDoubleInvalidValue : _minimumValues[storageIndex];
+        _treeMaximumValues[node] = isUnset ? -INFINITY : _maximumValues[storageIndex];
+        _treeUnsetCounts[node] = isUnset;
+    }
+}
+
+- (void)updateExtremaTreeInStorageRange:(NSRange)range {
+    if (!_hasExtremaTree || range.length == 0) {
+        // The tree is built with the current values on the next range query
+        return;
+    }
+    [self setExtremaTreeLeavesInStorageRange:range];
+    NSInteger firstNode = _treeLeafCount + range.location;
+    NSInteger lastNode = firstNode + range.length - 1;
+    // Only the ancestors of the updated leaves change, one level at a time
+    while (firstNode > 1) {
+        firstNode /= 2;
+        lastNode /= 2;
+        for (NSInteger node = firstNode; node <= lastNode; node++) {
+            [self updateExtremaTreeNode:node];
+        }
+    }
+}
+
+- (void)getMinimumValue:(double *)minimumValue maximumValue:(double *)maximumValue numberOfUnsetValues:(NSInteger *)numberOfUnsetValues inRange:(NSRange)range {
+    [self buildExtremaTreeIfNeeded];
+    range = NSIntersectionRange(range, NSMakeRange(0, _count));
+    
+    double minimum = SFDoubleInvalidValue;
+    double maximum = -INFINITY;
+    NSInteger unsetCount = 0;
+    NSInteger lowNode = _treeLeafCount + _windowStartIndex + range.location;
+    NSInteger highNode = lowNode + range.length;
+    while (lowNode < highNode) {
+        if (lowNode % 2 == 1) {
+            minimum = MIN(minimum, _treeMinimumValues[lowNode]);
+            maximum = MAX(maximum, _treeMaximumValues[lowNode]);
+            unsetCount += _treeUnsetCounts[lowNode];
+            lowNode++;
+        }
+        if (highNode % 2 == 1) {
+            highNode--;
+            minimum = MIN(minimum, _treeMinimumValues[highNode]);
+            maximum = MAX(maximum, _treeMaximumValues[highNode]);
+            unsetCount += _treeUnsetCounts[highNode];
+        }
+        lowNode /= 2;
+        highNode /= 2;
+    }
+    
+    if (minimumValue) {
+        *minimumValue = minimum;
+    }
+    if (maximumValue) {
+        *maximumValue = (maximum == -INFINITY) ? SFDoubleInvalidValue : maximum;
+    }
+    if (numberOfUnsetValues) {
+        *numberOfUnsetValues = unsetCount;
+    }
+}
+
+- (double)minimumValueInRange:(NSRange)range {
+    double minimumValue = SFDoubleInvalidValue;
+    [self getMinimumValue:&minimumValue maximumValue:NULL numberOfUnsetValues:NULL inRange:range];
+    return minimumValue;
+}
+
+- (double)maximumValueInRange:(NSRange)range {
+    double maximumValue = SFDoubleInvalidValue;
+    [self getMinimumValue:NULL maximumValue:&maximumValue numberOfUnsetValues:NULL inRange:range];
+    return maximumValue;
+}
+
+- (NSInteger)numberOfUnsetValuesInRange:(NSRange)range {
+    NSInteger numberOfUnsetValues = 0;
+    [self getMinimumValue:NULL maximumValue:NULL numberOfUnsetValues:&numberOfUnsetValues inRange:range];
+    return numberOfUnsetValues;
+}
+
+- (NSInteger)indexOfFirstValue:(double)value inRange:(NSRange)range minimum:(BOOL)minimum {
+    NSInteger start = _windowStartIndex + range.location;
+    NSInteger leaf = SFExtremaTreeFirstLeafWithValue(minimum ? _treeMinimumValues : _treeMaximumValues, minimum, value,
+                                                     1, 0, _treeLeafCount, start, start + range.length);
+    return (leaf == NSNotFound) ? NSNotFound : leaf - _windowStartIndex;
+}
+
+#pragma mark - Valid Neighbors
+
+- (void)buildValidIndexTablesIfNeeded {
+    if (_hasValidIndexTables) {
+        return;
+    }
+    if (_validIndexTableCapacity != _capacity) {
+        _nextValidIndexes = SFReallocBuffer(_nextValidIndexes, _capacity, sizeof(NSInteger));
+        _previousValidIndexes = SFReallocBuffer(_previousValidIndexes, _capacity, sizeof(NSInteger));
+        _validIndexTableCapacity = _capacity;
+    }
+    
+    // One pass in each direction carries the last valid storage index seen across the gaps
+    NSInteger startIndex = _windowStartIndex;
+    NSInteger endIndex = _windowStartIndex + _count;
+    NSInteger validIndex = -1;
+    for (NSInteger storageIndex = startIndex; storageIndex < endIndex; storageIndex++) {
+        if (!SFGraphValueIsUnset(_minimumValues[storageIndex], _maximumValues[storageIndex])) {
+            validIndex = storageIndex;
+        }
+        _previousValidIndexes[storageIndex] = validIndex;
+    }
+    validIndex = -1;
+    for (NSInteger storageIndex = endIndex - 1; storageIndex >= startIndex; storageIndex--) {
+        if (!SFGraphValueIsUnset(_minimumValues[storageIndex], _maximumValues[storageIndex])) {
+            validIndex = storageIndex;
+        }
+        _nextValidIndexes[storageIndex] = validIndex;
+    }
+    _hasValidIndexTables = YES;
+}
+
+- (void)updateValidIndexTablesForAppendedStorageIndex:(NSInteger)storageIndex {
+    if (!_hasValidIndexTables) {
+        // The tables are built with the current values on the next lookup
+        return;
+    }
+    BOOL hasPreviousValue = (storageIndex > _windowStartIndex);
+    if (SFGraphValueIsUnset(_minimumValues[storageIndex], _maximumValues[storageIndex])) {
+        _previousValidIndexes[storageIndex] = hasPreviousValue ? _previousValidIndexes[storageIndex - 1] : -1;
+        _nextValidIndexes[storageIndex] = -1;
+        return;
+    }
+    _previousValidIndexes[storageIndex] = storageIndex;
+    _nextValidIndexes[storageIndex] = storageIndex;
+    // Close the trailing gap, whose values had no next valid value; each value is closed once, so
+    // appending stays amortized O(1)
+    for (NSInteger gapIndex = storageIndex - 1; gapIndex >= _windowStartIndex && _nextValidIndexes[gapIndex] == -1; gapIndex--) {
+        _nextValidIndexes[gapIndex] = storageIndex;
+    }
+}
+
+- (NSInteger)indexOfValidValueAtOrAfterIndex:(NSInteger)index {
+    if (index < 0 || index >= _count) {
+        return NSNotFound;
+    }
+    [self buildValidIndexTablesIfNeeded];
+    NSInteger storageIndex = _nextValidIndexes[_windowStartIndex + index];
+    return (storageIndex == -1) ? NSNotFound : storageIndex - _windowStartIndex;
+}
+
+- (NSInteger)indexOfValidValueAtOrBeforeIndex:(NSInteger)index {
+    if (index < 0 || index >= _count) {
+        return NSNotFound;
+    }
+    [self buildValidIndexTablesIfNeeded];
+    NSInteger storageIndex = _previousValidIndexes[_windowStartIndex + index];
+    // Evicted values still appear in the table while streaming
+    return (storageIndex < _windowStartIndex) ? NSNotFound : storageIndex - _windowStartIndex;
+}
+
+#pragma mark - Canvas
+
+- (void)normalizeCanvasValuesInRange:(NSRange)range
+                        minimumValue:(double)minimumValue
+                        maximumValue:(double)maximumValue
+                        canvasHeight:(CGFloat)canvasHeight {
+    if (_stackOffsets) {
+        // canvasStackSums holds absolute canvas y-positions corresponding to each stacked value
+        // (rather than incremental y-positions as stackValues holds).
+        // E.g. (canvas height = 100)
+        //      stackValues = {10, 10, 20}
+        //        ->
+        //      canvasStackSums = {75, 50, 0}
+        NSInteger firstStackedValue = _stackOffsets[range.location];
+        NSInteger numberOfStackedValues = _stackOffsets[NSMaxRange(range)] - firstStackedValue;
+        double *canvasStackSums = _canvasStackSums + firstStackedValue;
+        SFGraphKernelMapToCanvas(_stackSums + firstStackedValue, canvasStackSums, numberOfStackedValues, minimumValue, maximumValue, canvasHeight, canvasHeight);
+        SFGraphKernelFloor(canvasStackSums, numberOfStackedValues);
+        return;
+    }
+    
+    // Value ranges are either fully set or fully unset, so each column can be mapped on its own
+    NSInteger storageIndex = _windowStartIndex + range.location;
+    NSInteger pointCount = range.length;
+    SFGraphKernelMapToCanvas(_minimumValues + storageIndex, _canvasMinimumValues + storageIndex, pointCount, minimumValue, maximumValue, canvasHeight, canvasHeight);
+    SFGraphKernelMapToCanvas(_maximumValues + storageIndex, _canvasMaximumValues + storageIndex, pointCount, minimumValue, maximumValue, canvasHeight, canvasHeight);
+}
+
+#pragma mark - Downsampling
+
+- (void)sampleExtremaInRange:(NSRange)range numberOfBuckets:(NSInteger)numberOfBuckets {
+    // Two indexes per bucket, along with the ends of the range
+    NSInteger sampledCapacity = 2 * MAX(numberOfBuckets, 1) + 2;
+    if (sampledCapacity > _sampledCapacity) {
+        _sampledIndexes = SFReallocBuffer(_sampledIndexes, sampledCapacity, sizeof(NSInteger));
+        _sampledIndexesFollowGaps = SFReallocBuffer(_sampledIndexesFollowGaps, sampledCapacity, sizeof(BOOL));
+        _sampledCapacity = sampledCapacity;
+    }
+    
+    range = NSIntersectionRange(range, NSMakeRange(0, _count));
+    _numberOfSampledIndexes = 0;
+    if (range.length == 0) {
+        return;
+    }
+    // The first and last valid values of the range are always kept, so the downsampled line starts
+    // and ends where the full line would; sampled indexes only address valid values
+    NSInteger firstIndex = [self indexOfValidValueAtOrAfterIndex:range.location];
+    NSInteger lastIndex = [self indexOfValidValueAtOrBeforeIndex:NSMaxRange(range) - 1];
+    if (firstIndex == NSNotFound || firstIndex > lastIndex) {
+        return;
+    }
+    
+    NSInteger numberOfSampledIndexes = 0;
+    _sampledIndexes[numberOfSampledIndexes++] = firstIndex;
+    NSInteger bucketStartIndex = range.location;
+    for (NSInteger bucketIndex = 0; bucketIndex < numberOfBuckets; bucketIndex++) {
+        NSInteger bucketEndIndex = range.location + (bucketIndex + 1) * (NSInteger)range.length / numberOfBuckets;
+        NSRange bucketRange = NSMakeRange(bucketStartIndex, bucketEndIndex - bucketStartIndex);
+        double minimumValue = SFDoubleInvalidValue;
+        double maximumValue = SFDoubleInvalidValue;
+        [self getMinimumValue:&minimumValue maximumValue:&maximumValue numberOfUnsetValues:NULL inRange:bucketRange];
+        if (minimumValue != SFDoubleInvalidValue) {
+            NSInteger minimumIndex = [self indexOfFirstValue:minimumValue inRange:bucketRange minimum:YES];
+            NSInteger maximumIndex = [self indexOfFirstValue:maximumValue inRange:bucketRange minimum:NO];
+            // Indexes ascend across buckets, so only the first index can already be kept
+            if (MIN(minimumIndex, maximumIndex) > firstIndex) {
+                _sampledIndexes[numberOfSampledIndexes++] = MIN(minimumIndex, maximumIndex);
+            }
+            if (minimumIndex != maximumIndex && MAX(minimumIndex, maximumIndex) > firstIndex) {
+                _sampledIndexes[numberOfSampledIndexes++] = MAX(minimumIndex, maximumIndex);
+            }
+        }
+        bucketStartIndex = bucketEndIndex;
+    }
+    if (_sampledIndexes[numberOfSampledIndexes - 1] != lastIndex) {
+        _sampledIndexes[numberOfSampledIndexes++] = lastIndex;
+    }
+    
+    // Flag the sampled indexes preceded by unset values since the previous sampled index
+    NSInteger gapStartIndex = range.location;
+    for (NSInteger sampledIndex = 0; sampledIndex < numberOfSampledIndexes; sampledIndex++) {
+        NSRange gapRange = NSMakeRange(gapStartIndex, _sampledIndexes[sampledIndex] - gapStartIndex);
+        _sampledIndexesFollowGaps[sampledIndex] = ([self numberOfUnsetValuesInRange:gapRange] > 0);
+        gapStartIndex = _sampledIndexes[sampledIndex] + 1;
+    }
+    _numberOfSampledIndexes = numberOfSampledIndexes;
+}
+
+- (BOOL)hasCanvasValuesInRange:(NSRange)range {
+    return _hasCanvasValues && (NSIntersectionRange(range, _canvasValuesRange).length == range.length);
+}
+
+- (BOOL)isUnsetAtIndex:(NSInteger)index {
+    return SFGraphValueIsUnset(_minimumValues[_windowStartIndex + index], _maximumValues[_windowStartIndex + index]);
+}
+
+- (NSInteger)numberOfStackedValuesAtIndex:(NSInteger)index {
+    if (!_stackOffsets) {
+        return 0;
+    }
+    return _stackOffsets[index + 1] - _stackOffsets[index];
+}
+
+- (NSString *)description {
+    return [NSString stringWithFormat:@"<%@: %p; count = %ld; validValues = %ld>", self.class.description, self, (long)_count, (long)_numberOfValidValues];
+}
+
+@end
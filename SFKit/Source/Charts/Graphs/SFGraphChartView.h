@@ -34,6 +34,7 @@
 
 @import UIKit;
 #import "SFDefines.h"
+#import "SFChartPerformanceObserver.h"
 
 
 NS_ASSUME_NONNULL_BEGIN
@@ -42,6 +43,15 @@ NS_ASSUME_NONNULL_BEGIN
 @class SFValueStack;
 @class SFGraphChartView;
 
+/**
+ The value of a plot at the scrubber, as reported by `graphChartView:didScrubToValues:numberOfPlots:`.
+ */
+typedef struct SFGraphChartScrubbingValue {
+    NSInteger pointIndex; // NSNotFound when the plot has no point at the scrubber
+    double minimumValue; // SFDoubleInvalidValue when the point is unset
+    double maximumValue; // SFDoubleInvalidValue when the point is unset
+} SFGraphChartScrubbingValue;
+
 /**
  The graph chart view delegate protocol forwards pan gesture events occuring
  within the bounds of an `SFGraphChartView` object.
@@ -60,13 +70,28 @@ SF_AVAILABLE_DECL
 
 /**
  Notifies the delegate of updates in the x-coordinate of an ongoing pan gesture within the bounds
- of an `SFGraphChartView` object.
+ of an `SFGraphChartView` object. Updates are coalesced to at most one per display frame, and are
+ only sent when the scrubber moves to another x-coordinate.
 
  @param graphChartView      The graph chart view object in which the gesture occurred.
  @param xPosition           The updated x-coordinate of the ongoing pan gesture.
 */
 - (void)graphChartView:(SFGraphChartView *)graphChartView touchesMovedToXPosition:(CGFloat)xPosition;
 
+/**
+ Notifies the delegate of the values of every plot at the scrubber, whenever the scrubber moves while
+ `scrubsAllPlots` is `YES`.
+ 
+ The scrubbed point is resolved once for the scrubbing plot, and the values are read directly from the
+ stored values of each plot, so reporting every plot costs about as much as reporting a single one.
+
+ @param graphChartView      The graph chart view object in which the gesture occurred.
+ @param values              The value of each plot, indexed by plot index. The buffer is only valid
+                                for the duration of the call.
+ @param numberOfPlots       The number of values in `values`.
+*/
+- (void)graphChartView:(SFGraphChartView *)graphChartView didScrubToValues:(const SFGraphChartScrubbingValue *)values numberOfPlots:(NSInteger)numberOfPlots;
+
 /**
  Notifies the delegate that a pan gesture that began within the bounds of an `SFGraphChartView`
  object has ended.
@@ -75,6 +100,18 @@ SF_AVAILABLE_DECL
 */
 - (void)graphChartViewTouchesEnded:(SFGraphChartView *)graphChartView;
 
+/**
+ Notifies the delegate that a point was selected by tapping it in an `SFBarGraphChartView` or
+ `SFDiscreteGraphChartView` object.
+
+ @param graphChartView      The graph chart view object in which the point was tapped.
+ @param pointIndex          The index of the selected point in its plot.
+ @param plotIndex           An index number identifying the plot of the selected point.
+ @param subpointIndex       The index of the selected stacked value in a bar graph chart view. This
+                                index is always 0 in discrete graph chart views.
+*/
+- (void)graphChartView:(SFGraphChartView *)graphChartView didSelectPointAtIndex:(NSInteger)pointIndex plotIndex:(NSInteger)plotIndex subpointIndex:(NSInteger)subpointIndex;
+
 @end
 
 
@@ -298,6 +335,29 @@ SF_AVAILABLE_DECL
  */
 - (SFValueRange *)graphChartView:(SFGraphChartView *)graphChartView dataPointForPointIndex:(NSInteger)pointIndex plotIndex:(NSInteger)plotIndex;
 
+@optional
+/**
+ Asks the data source to fill the specified buffers with the minimum and maximum values of the
+ value ranges in the specified range of point indexes for the specified plot.
+ 
+ Implement this method when your data is already stored in contiguous arrays. The graph chart view
+ then uses it instead of `graphChartView:dataPointForPointIndex:plotIndex:`, obtaining all the
+ values of a plot in a single call rather than one `SFValueRange` object per point.
+ 
+ Set both the minimum and maximum value of a point to `SFDoubleInvalidValue` to denote an unset
+ value range.
+ 
+ @param graphChartView      The graph chart view that is asking for the values.
+ @param minimumValues       A buffer with room for `range.length` values, to be filled with the
+                                minimum values of the value ranges starting at `range.location`.
+ @param maximumValues       A buffer with room for `range.length` values, to be filled with the
+                                maximum values of the value ranges starting at `range.location`.
+ @param range               The range of point indexes whose values are requested.
+ @param plotIndex           An index number identifying the plot in the graph chart view. This index
+                                is 0 in a single-plot graph chart view.
+ */
+- (void)graphChartView:(SFGraphChartView *)graphChartView getMinimumValues:(double *)minimumValues maximumValues:(double *)maximumValues range:(NSRange)range plotIndex:(NSInteger)plotIndex;
+
 @end
 
 
@@ -392,6 +452,13 @@ IB_DESIGNABLE
 */
 @property (nonatomic, weak) id <SFGraphChartViewDataSource> dataSource;
 
+/**
+ The object told how long each phase of reloading and laying out the chart took.
+
+ See the `SFChartPerformanceObserver` protocol.
+ */
+@property (nonatomic, weak, nullable) id <SFChartPerformanceObserver> performanceObserver;
+
 /**
  The color of the axes drawn by the graph chart view.
  
@@ -471,6 +538,78 @@ IB_DESIGNABLE
  */
 @property (nonatomic, strong, readonly) UIPanGestureRecognizer *panGestureRecognizer;
 
+/**
+ The gesture recognizer that is used for selecting points by the graph chart view. Taps are only hit
+ tested when the delegate implements `graphChartView:didSelectPointAtIndex:plotIndex:subpointIndex:`.
+ 
+ This object is instatiated and added to the view when it is created.
+ */
+@property (nonatomic, strong, readonly) UITapGestureRecognizer *tapGestureRecognizer;
+
+/**
+ A Boolean value that indicates whether scrubbing reports the values of every plot to the delegate,
+ through `graphChartView:didScrubToValues:numberOfPlots:`. The scrubber itself still snaps to the plot
+ returned by `scrubbingPlotIndexForGraphChartView:`.
+ 
+ The default value of this property is `NO`.
+ */
+@property (nonatomic) BOOL scrubsAllPlots;
+
+/**
+ The range of x-axis points that is displayed by the graph chart view.
+ 
+ Points outside of the visible range are neither laid out nor drawn, and the value range is
+ calculated from the visible points unless it is provided by the data source. The range is clamped
+ to the number of x-axis points, and a range with a length of `0` displays every x-axis point.
+ 
+ The default value of this property is a range with a length of `0`.
+ */
+@property (nonatomic) NSRange visibleXAxisRange;
+
+/**
+ A Boolean value that indicates whether the visible x-axis range can be changed by pinching to zoom
+ and panning with two fingers.
+ 
+ Scrubbing is limited to a single finger when zooming is enabled.
+ 
+ The default value of this property is `NO`.
+ */
+@property (nonatomic, getter=isZoomingEnabled) BOOL zoomingEnabled;
+
+/**
+ The number of layers and path vertices above which the graph chart view draws its plots into bitmap
+ tiles on a background queue, rather than with shape layers.
+ 
+ Shape layers are committed and rasterized again whenever they change, which becomes expensive for
+ very large plots. Tiles are only drawn as they come into view: panning the visible range draws the
+ tiles scrolling in, unless the value range adapts to the visible points, while zooming and data
+ changes draw every visible tile again. The plots return to shape layers once they drop under half
+ of the budget. Tiled line plots do not draw point indicators.
+ 
+ The default value of this property is 50000. A value of 0 always draws the plots with shape layers.
+ */
+@property (nonatomic) NSInteger renderingComplexityBudget;
+
+/**
+ A Boolean value that indicates whether the plots are drawn into bitmap tiles, as their complexity
+ exceeds the `renderingComplexityBudget`.
+ */
+@property (nonatomic, readonly) BOOL usesTiledRendering;
+
+/**
+ The gesture recognizer that is used for zooming by the graph chart view.
+ 
+ This object is instatiated and added to the view when it is created.
+ */
+@property (nonatomic, strong, readonly) UIPinchGestureRecognizer *pinchGestureRecognizer;
+
+/**
+ The gesture recognizer that is used for panning the visible x-axis range by the graph chart view.
+ 
+ This object is instatiated and added to the view when it is created.
+ */
+@property (nonatomic, strong, readonly) UIPanGestureRecognizer *zoomingPanGestureRecognizer;
+
 /**
  The number of decimal places that is used on the y-axis and scrubber value labels.
  
@@ -495,6 +634,68 @@ IB_DESIGNABLE
 */
 - (void)reloadData;
 
+/**
+ Reloads the plotted data, computing the value range and the normalized point positions on a
+ background queue.
+
+ The data source is queried on the main thread before this method returns, and the reloaded data
+ is displayed on the main thread once it has been processed. Until then, the previously plotted
+ data stays visible. A reload started later, by this method or by `reloadData`, supersedes any
+ reload in progress, whose results are then discarded.
+
+ @param completion      A block called on the main thread once the reload is finished. Its
+                        `finished` parameter is `NO` if the reload was superseded.
+ */
+- (void)reloadDataWithCompletion:(nullable void (^)(BOOL finished))completion;
+
+/**
+ Applies multiple point insertions, deletions and reloads as a group.
+ 
+ Use this method to update the graph chart view when only some of the points provided by the data
+ source change, for example when new samples are appended to a plot. Only the affected points are
+ obtained from the data source, and only the affected plots are re-plotted unless the value range
+ or the number of x-axis points changes.
+ 
+ As with `UITableView`, deletions and reloads within the `updates` block refer to point indexes
+ before the update, and insertions refer to point indexes after the update, regardless of the order
+ in which they are issued. When the updates are applied, the number of points reported by the data
+ source for each plot must equal its previous number of points, minus the deleted points, plus the
+ inserted points.
+ 
+ @param updates             A block that performs the insertions, deletions and reloads.
+ */
+- (void)performBatchUpdates:(void (NS_NOESCAPE ^ _Nullable)(void))updates;
+
+/**
+ Inserts points at the specified indexes of the specified plot.
+ 
+ When called outside of a `performBatchUpdates:` block, the insertion is applied immediately.
+ 
+ @param indexes             The indexes of the inserted points, once the insertion is complete.
+ @param plotIndex           An index number identifying the plot in the graph chart view.
+ */
+- (void)insertPointsAtIndexes:(NSIndexSet *)indexes inPlot:(NSInteger)plotIndex;
+
+/**
+ Deletes the points at the specified indexes of the specified plot.
+ 
+ When called outside of a `performBatchUpdates:` block, the deletion is applied immediately.
+ 
+ @param indexes             The indexes of the deleted points.
+ @param plotIndex           An index number identifying the plot in the graph chart view.
+ */
+- (void)deletePointsAtIndexes:(NSIndexSet *)indexes inPlot:(NSInteger)plotIndex;
+
+/**
+ Obtains the points at the specified indexes of the specified plot from the data source again.
+ 
+ When called outside of a `performBatchUpdates:` block, the reload is applied immediately.
+ 
+ @param indexes             The indexes of the reloaded points.
+ @param plotIndex           An index number identifying the plot in the graph chart view.
+ */
+- (void)reloadPointsAtIndexes:(NSIndexSet *)indexes inPlot:(NSInteger)plotIndex;
+
 @end
 
 
@@ -515,6 +716,18 @@ SF_CLASS_AVAILABLE
  */
 @property (nonatomic, weak) id <SFValueRangeGraphChartViewDataSource> dataSource;
 
+/**
+ The maximum number of point indicators a plot can have for its indicators to pop in one after the
+ other when the graph chart view is animated.
+ 
+ Plots with more point indicators than this value draw all of their indicators as a single compound
+ path, which fades in as a whole when animated. Plots at or below this value draw each indicator in
+ its own layer, which is only suitable for a small number of points.
+ 
+ The default value of this property is 0, so every plot draws its indicators as a compound path.
+ */
+@property (nonatomic) NSInteger maximumNumberOfSequentiallyAnimatedPoints;
+
 @end
 
 NS_ASSUME_NONNULL_END
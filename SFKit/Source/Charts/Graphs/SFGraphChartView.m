@@ -43,6 +43,7 @@
 #import "SFSkin.h"
 
 #import <SFKit/SFAccessibility.h>
+#import "SFLeastRecentlyUsedCache.h"
 
 #if TARGET_INTERFACE_BUILDER
 
@@ -79,6 +80,8 @@ const CGFloat SFGraphChartViewPointAndLineWidth = 8.0;
 const CGFloat SFGraphChartViewScrubberMoveAnimationDuration = 0.1;
 const CGFloat SFGraphChartViewAxisTickLength = 12.0;
 const CGFloat SFGraphChartViewYAxisTickPadding = 2.0;
+const CGFloat SFGraphChartViewPointIndicatorLineWidth = 2.0;
+const CGFloat SFGraphChartViewSelectionHitSlop = 8.0;
 
 static const CGFloat TopPadding = 7.0;
 static const CGFloat XAxisViewHeight = 30.0;
@@ -90,9 +93,13 @@ static const CGFloat ScrubberLineToLabelPadding = 6.0;
 static const CGFloat ScrubberLabelCornerRadius = 4.0;
 static const CGFloat ScrubberLabelHorizontalPadding = 12.0;
 static const CGFloat ScrubberLabelVerticalPadding = 4.0;
+static const NSInteger MinimumNumberOfVisibleXAxisPoints = 2;
+static const NSInteger CulledRangeMargin = 1; // Points kept on each side of the visible range so lines leave the plot view
+static const NSInteger DefaultRenderingComplexityBudget = 50000;
+static const NSInteger AccessibilityElementCacheCapacity = 256;
 #define ScrubberLabelColor ([UIColor colorWithWhite:0.98 alpha:0.8])
 
-@interface SFGraphChartView () <UIGestureRecognizerDelegate>
+@interface SFGraphChartView () <UIGestureRecognizerDelegate, SFLineGraphAccessibilityElementDataSource>
 
 @end
 
@@ -107,6 +114,41 @@ static const CGFloat ScrubberLabelVerticalPadding = 4.0;
     UILabel *_scrubberLabel;
     UIView *_scrubberThumbView;
     NSString *_decimalFormat;
+    CGFloat _canvasHeight;
+    NSInteger _batchUpdatesDepth;
+    NSMutableDictionary<NSNumber *, NSMutableIndexSet *> *_batchDeletedIndexes;
+    NSMutableDictionary<NSNumber *, NSMutableIndexSet *> *_batchInsertedIndexes;
+    NSMutableDictionary<NSNumber *, NSMutableIndexSet *> *_batchReloadedIndexes;
+    CGFloat *_xAxisPositions; // Cached xAxisPointInRange() of every x-axis point for the visible range
+    NSInteger _numberOfXAxisPositions;
+    CGFloat _xAxisPositionsCanvasWidth;
+    NSUInteger _reloadGeneration; // Incremented by every reload, so superseded asynchronous reloads are dropped
+    NSInteger _numberOfPendingReloads;
+    NSMutableArray<CAShapeLayer *> *_reusableLineLayers; // Layers of the previous update, reused by the update in progress
+    SFGraphChartViewInvalidation _invalidation; // Layout stages to redo on the next layout pass
+    CGSize _laidOutPlotViewSize;
+    NSRange _xAxisPositionsVisibleRange;
+    NSRange _zoomingGestureStartRange; // Visible x-axis point range when the current zooming gesture began
+    SFGraphChartTileRenderer *_tileRenderer; // Draws the plots while they use tiled rendering
+    BOOL _tilesFollowVisibleRange; // Whether the tiles are positioned for the x-axis points, and pan with the visible range
+    BOOL _hasValidTiles;
+    double _tiledMinimumValue;
+    double _tiledMaximumValue;
+    CGSize _tiledCanvasSize;
+    NSInteger _tiledNumberOfVisibleXAxisPoints;
+    CADisplayLink *_scrubberDisplayLink; // Coalesces the scrubbing gesture updates to one per frame while scrubbing
+    BOOL _hasPendingScrubberUpdate;
+    BOOL _measuresCommit; // Whether the commit following a batch update is being measured
+    CGFloat _pendingScrubberXPosition;
+    NSInteger _pendingScrubberPlotIndex;
+    CGFloat _scrubberXPosition; // Snapped x position and plot of the last scrubber update
+    NSInteger _scrubberPlotIndex;
+    double _scrubberLabelValue; // Value formatted by the scrubber label, NAN once the text must be redone
+    CGSize _scrubberLabelTextSize;
+    SFGraphChartScrubbingValue *_scrubbingValues; // Reported to the delegate when scrubbing every plot
+    NSInteger _scrubbingValuesCapacity;
+    SFLeastRecentlyUsedCache<NSNumber *, SFLineGraphAccessibilityElement *> *_axElementCache; // Elements created as VoiceOver asks for them
+    NSUInteger _axStringGeneration; // Incremented whenever the formatted strings of the elements become stale
 }
 
 #pragma mark - Init
@@ -125,19 +167,343 @@ static const CGFloat ScrubberLabelVerticalPadding = 4.0;
     return self;
 }
 
+// Resolves the unset limits from the plot buffers; only the plot buffers are read, so a snapshot can be
+// resolved off the main thread
+static void resolveValueLimitsOfPlotBuffers(NSArray<SFGraphChartPlotBuffer *> *plotBuffers, NSRange range, double *minimumValue, double *maximumValue) {
+    // The limits not provided by the data source span the visible values of every plot, each
+    // resolved in O(log n) from the range extrema of the plot buffer
+    BOOL resolvesMinimumValue = (*minimumValue == SFDoubleInvalidValue);
+    BOOL resolvesMaximumValue = (*maximumValue == SFDoubleInvalidValue);
+    for (SFGraphChartPlotBuffer *plotBuffer in plotBuffers) {
+        NSRange plotRange = NSIntersectionRange(range, NSMakeRange(0, plotBuffer.count));
+        if (resolvesMinimumValue) {
+            double plotMinimumValue = [plotBuffer minimumValueInRange:plotRange];
+            if (plotMinimumValue != SFDoubleInvalidValue &&
+                ((*minimumValue == SFDoubleInvalidValue) || (plotMinimumValue < *minimumValue))) {
+                *minimumValue = plotMinimumValue;
+            }
+        }
+        if (resolvesMaximumValue) {
+            double plotMaximumValue = [plotBuffer maximumValueInRange:plotRange];
+            if (plotMaximumValue != SFDoubleInvalidValue &&
+                ((*maximumValue == SFDoubleInvalidValue) || (plotMaximumValue > *maximumValue))) {
+                *maximumValue = plotMaximumValue;
+            }
+        }
+    }
+    
+    if (*minimumValue == SFDoubleInvalidValue) {
+        *minimumValue = 0;
+    }
+    if (*maximumValue == SFDoubleInvalidValue) {
+        *maximumValue = 0;
+    }
+}
+
+SF_INLINE NSInteger numberOfBufferedPoints(NSArray<SFGraphChartPlotBuffer *> *plotBuffers) {
+    NSInteger numberOfPoints = 0;
+    for (SFGraphChartPlotBuffer *plotBuffer in plotBuffers) {
+        numberOfPoints += plotBuffer.count;
+    }
+    return numberOfPoints;
+}
+
 - (void)reloadData {
+    _reloadGeneration++;
     _numberOfXAxisPoints = -1; // reset cached number of x axis points
     [self updateAndLayoutVerticalReferenceLineLayers];
+    
+    SFChartPhaseInterval interval = SFChartPhaseBegin(self, SFChartPhaseDataSource);
     [self obtainDataPoints];
+    NSInteger numberOfPoints = numberOfBufferedPoints(_plotBuffers);
+    SFChartPhaseEnd(self, interval, numberOfPoints, _performanceObserver);
+    
+    interval = SFChartPhaseBegin(self, SFChartPhaseExtrema);
     [self calculateMinAndMaxValues];
+    SFChartPhaseEnd(self, interval, numberOfPoints, _performanceObserver);
+    
+    interval = SFChartPhaseBegin(self, SFChartPhaseLayerUpdate);
+    [self updateLayersForReloadedData];
+    SFChartPhaseEnd(self, interval, numberOfPoints, _performanceObserver);
+}
+
+- (void)reloadDataWithCompletion:(void (^)(BOOL))completion {
+    NSUInteger reloadGeneration = ++_reloadGeneration;
+    
+    // Snapshot the data source into buffers that are not displayed yet; the displayed plots keep
+    // their number of x-axis points until the reload is committed
+    SFChartPhaseInterval interval = SFChartPhaseBegin(self, SFChartPhaseDataSource);
+    NSInteger displayedNumberOfXAxisPoints = _numberOfXAxisPoints;
+    _numberOfXAxisPoints = -1;
+    NSInteger numberOfXAxisPoints = self.numberOfXAxisPoints;
+    NSInteger numberOfPlots = [self numberOfPlots];
+    NSMutableArray<SFGraphChartPlotBuffer *> *plotBuffers = [NSMutableArray arrayWithCapacity:numberOfPlots];
+    for (NSInteger plotIndex = 0; plotIndex < numberOfPlots; plotIndex++) {
+        SFGraphChartPlotBuffer *plotBuffer = [[SFGraphChartPlotBuffer alloc] initWithCapacity:numberOfXAxisPoints];
+        [self fillPlotBuffer:plotBuffer forPlotIndex:plotIndex];
+        [plotBuffers addObject:plotBuffer];
+    }
+    _numberOfXAxisPoints = displayedNumberOfXAxisPoints;
+    NSInteger numberOfPoints = numberOfBufferedPoints(plotBuffers);
+    SFChartPhaseEnd(self, interval, numberOfPoints, _performanceObserver);
+    NSRange visibleRange = [self visibleXAxisPointRangeForNumberOfXAxisPoints:numberOfXAxisPoints];
+    
+    double providedMinimumValue = SFDoubleInvalidValue;
+    double providedMaximumValue = SFDoubleInvalidValue;
+    [self getProvidedMinimumValue:&providedMinimumValue maximumValue:&providedMaximumValue];
+    CGFloat canvasHeight = _plotView.bounds.size.height;
+    _numberOfPendingReloads++;
+    
+    dispatch_async(dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^{
+        // Only the snapshot is read and written here, never the views or the data source; the view is
+        // only passed along to the signposts, and the phase metrics are reported back on the main thread
+        SFChartPhaseInterval extremaInterval = SFChartPhaseBegin(self, SFChartPhaseExtrema);
+        double minimumValue = providedMinimumValue;
+        double maximumValue = providedMaximumValue;
+        resolveValueLimitsOfPlotBuffers(plotBuffers, visibleRange, &minimumValue, &maximumValue);
+        SFChartPhaseMetrics *extremaMetrics = SFChartPhaseEndOffMainThread(extremaInterval, numberOfPoints);
+        
+        SFChartPhaseInterval normalizationInterval = SFChartPhaseBegin(self, SFChartPhaseNormalization);
+        for (SFGraphChartPlotBuffer *plotBuffer in plotBuffers) {
+            NSRange range = NSMakeRange(0, plotBuffer.count);
+            [plotBuffer normalizeCanvasValuesInRange:range minimumValue:minimumValue maximumValue:maximumValue canvasHeight:canvasHeight];
+            plotBuffer.canvasValuesRange = range;
+            plotBuffer.hasCanvasValues = YES;
+        }
+        SFChartPhaseMetrics *normalizationMetrics = SFChartPhaseEndOffMainThread(normalizationInterval, numberOfPoints);
+        
+        dispatch_async(dispatch_get_main_queue(), ^{
+            self->_numberOfPendingReloads--;
+            SFChartPhaseReport(self, extremaMetrics, self->_performanceObserver);
+            SFChartPhaseReport(self, normalizationMetrics, self->_performanceObserver);
+            if (reloadGeneration != self->_reloadGeneration) {
+                // A later reload superseded this one
+                if (completion) {
+                    completion(NO);
+                }
+                return;
+            }
+            
+            self->_plotBuffers = plotBuffers;
+            self->_numberOfXAxisPoints = numberOfXAxisPoints;
+            self.minimumValue = minimumValue;
+            self.maximumValue = maximumValue;
+            self.hasDataPoints = NO;
+            for (SFGraphChartPlotBuffer *plotBuffer in plotBuffers) {
+                if (plotBuffer.numberOfValidValues > 0) {
+                    self.hasDataPoints = YES;
+                }
+            }
+            if (canvasHeight == self.plotView.bounds.size.height) {
+                self->_canvasHeight = canvasHeight;
+            } else {
+                [self invalidateCanvasValues];
+            }
+            
+            [self updateAndLayoutVerticalReferenceLineLayers];
+            SFChartPhaseInterval layerUpdateInterval = SFChartPhaseBegin(self, SFChartPhaseLayerUpdate);
+            [self updateLayersForReloadedData];
+            SFChartPhaseEnd(self, layerUpdateInterval, numberOfPoints, self->_performanceObserver);
+            if (completion) {
+                completion(YES);
+            }
+        });
+    });
+}
+
+- (void)updateLayersForReloadedData {
     [_xAxisView updateTitles];
     [_yAxisView updateTicksAndLabels];
     [self updateLineLayers];
     [self updateNoDataLabel];
     
-    [self _axCreateAccessibilityElementsIfNeeded];
+    [self _axInvalidateAccessibilityElements];
     
-    [self setNeedsLayout];
+    [self invalidateLayout:SFGraphChartViewInvalidationData];
+}
+
+#pragma mark - Batch Updates
+
+SF_INLINE NSMutableIndexSet *batchIndexSetForPlotIndex(NSMutableDictionary<NSNumber *, NSMutableIndexSet *> *indexSets, NSInteger plotIndex) {
+    NSMutableIndexSet *indexSet = indexSets[@(plotIndex)];
+    if (!indexSet) {
+        indexSet = [NSMutableIndexSet new];
+        indexSets[@(plotIndex)] = indexSet;
+    }
+    return indexSet;
+}
+
+- (void)performBatchUpdates:(void (NS_NOESCAPE ^)(void))updates {
+    _batchUpdatesDepth++;
+    if (updates) {
+        updates();
+    }
+    _batchUpdatesDepth--;
+    
+    if (_batchUpdatesDepth == 0) {
+        [self applyBatchUpdates];
+    }
+}
+
+- (void)insertPointsAtIndexes:(NSIndexSet *)indexes inPlot:(NSInteger)plotIndex {
+    [self performBatchUpdates:^{
+        [batchIndexSetForPlotIndex(self->_batchInsertedIndexes, plotIndex) addIndexes:indexes];
+    }];
+}
+
+- (void)deletePointsAtIndexes:(NSIndexSet *)indexes inPlot:(NSInteger)plotIndex {
+    [self performBatchUpdates:^{
+        [batchIndexSetForPlotIndex(self->_batchDeletedIndexes, plotIndex) addIndexes:indexes];
+    }];
+}
+
+- (void)reloadPointsAtIndexes:(NSIndexSet *)indexes inPlot:(NSInteger)plotIndex {
+    [self performBatchUpdates:^{
+        [batchIndexSetForPlotIndex(self->_batchReloadedIndexes, plotIndex) addIndexes:indexes];
+    }];
+}
+
+- (void)applyBatchUpdates {
+    NSDictionary<NSNumber *, NSIndexSet *> *deletedIndexes = _batchDeletedIndexes;
+    NSDictionary<NSNumber *, NSIndexSet *> *insertedIndexes = _batchInsertedIndexes;
+    NSDictionary<NSNumber *, NSIndexSet *> *reloadedIndexes = _batchReloadedIndexes;
+    _batchDeletedIndexes = [NSMutableDictionary new];
+    _batchInsertedIndexes = [NSMutableDictionary new];
+    _batchReloadedIndexes = [NSMutableDictionary new];
+    
+    if (_numberOfPendingReloads > 0) {
+        // The pending reload snapshotted the data source before these updates, so reload it again
+        [self reloadData];
+        return;
+    }
+    
+    NSMutableIndexSet *updatedPlotIndexes = [NSMutableIndexSet new];
+    for (NSNumber *plotIndex in [[deletedIndexes.allKeys arrayByAddingObjectsFromArray:insertedIndexes.allKeys] arrayByAddingObjectsFromArray:reloadedIndexes.allKeys]) {
+        [updatedPlotIndexes addIndex:plotIndex.unsignedIntegerValue];
+    }
+    if (updatedPlotIndexes.count == 0) {
+        return;
+    }
+    
+    NSInteger numberOfPlots = [self numberOfPlots];
+    if (_plotBuffers.count != numberOfPlots || _lineLayers.count != numberOfPlots) {
+        @throw [NSException exceptionWithName:NSInternalInconsistencyException
+                                       reason:@"Invalid update: the number of plots changed since the last reload. Call reloadData instead."
+                                     userInfo:nil];
+    }
+    if (updatedPlotIndexes.lastIndex >= (NSUInteger)numberOfPlots) {
+        @throw [NSException exceptionWithName:NSRangeException
+                                       reason:[NSString stringWithFormat:@"Invalid update: plot index %lu beyond bounds [0 .. %ld]", (unsigned long)updatedPlotIndexes.lastIndex, (long)numberOfPlots - 1]
+                                     userInfo:nil];
+    }
+    
+    NSInteger previousNumberOfXAxisPoints = self.numberOfXAxisPoints;
+    double previousMinimumValue = self.minimumValue;
+    double previousMaximumValue = self.maximumValue;
+    
+    SFChartPhaseInterval interval = SFChartPhaseBegin(self, SFChartPhaseDataSource);
+    [updatedPlotIndexes enumerateIndexesUsingBlock:^(NSUInteger plotIndex, BOOL *stop) {
+        [self applyUpdatesForPlotIndex:plotIndex
+                        deletedIndexes:deletedIndexes[@(plotIndex)] ?: [NSIndexSet indexSet]
+                       insertedIndexes:insertedIndexes[@(plotIndex)] ?: [NSIndexSet indexSet]
+                       reloadedIndexes:reloadedIndexes[@(plotIndex)] ?: [NSIndexSet indexSet]];
+    }];
+    
+    _numberOfXAxisPoints = -1; // reset cached number of x axis points
+    NSInteger numberOfXAxisPoints = self.numberOfXAxisPoints;
+    _hasDataPoints = NO;
+    for (SFGraphChartPlotBuffer *plotBuffer in _plotBuffers) {
+        [plotBuffer padWithUnsetValuesToCount:numberOfXAxisPoints];
+        if (plotBuffer.numberOfValidValues > 0) {
+            _hasDataPoints = YES;
+        }
+    }
+    NSInteger numberOfPoints = numberOfBufferedPoints(_plotBuffers);
+    SFChartPhaseEnd(self, interval, numberOfPoints, _performanceObserver);
+    
+    interval = SFChartPhaseBegin(self, SFChartPhaseExtrema);
+    [self calculateMinAndMaxValues];
+    SFChartPhaseEnd(self, interval, numberOfPoints, _performanceObserver);
+    
+    interval = SFChartPhaseBegin(self, SFChartPhaseLayerUpdate);
+    BOOL numberOfXAxisPointsChanged = (numberOfXAxisPoints != previousNumberOfXAxisPoints);
+    BOOL valueRangeChanged = (self.minimumValue != previousMinimumValue || self.maximumValue != previousMaximumValue);
+    if (numberOfXAxisPointsChanged || insertedIndexes.count > 0 || deletedIndexes.count > 0) {
+        // Point indexes shifted, so do the x axis titles and the vertical reference lines
+        [self updateAndLayoutVerticalReferenceLineLayers];
+        [_xAxisView updateTitles];
+    }
+    if (valueRangeChanged) {
+        [self valueRangeDidChange];
+    }
+    if (numberOfXAxisPointsChanged || valueRangeChanged) {
+        // Every plot is re-plotted against the updated axes
+        [updatedPlotIndexes addIndexesInRange:NSMakeRange(0, numberOfPlots)];
+    }
+    
+    [updatedPlotIndexes enumerateIndexesUsingBlock:^(NSUInteger plotIndex, BOOL *stop) {
+        [self updatePlotLayersForPlotIndex:plotIndex];
+    }];
+    [self updateNoDataLabel];
+    SFChartPhaseEnd(self, interval, numberOfPoints, _performanceObserver);
+    
+    interval = SFChartPhaseBegin(self, SFChartPhaseNormalization);
+    [self updateCanvasValues];
+    SFChartPhaseEnd(self, interval, numberOfPoints, _performanceObserver);
+    if ([self hasCanvasValues]) {
+        interval = SFChartPhaseBegin(self, SFChartPhaseLayout);
+        [updatedPlotIndexes enumerateIndexesUsingBlock:^(NSUInteger plotIndex, BOOL *stop) {
+            [self layoutPlotLayersForPlotIndex:plotIndex];
+        }];
+        SFChartPhaseEnd(self, interval, numberOfPoints, _performanceObserver);
+        // Batch updates lay out outside of the commit, so the commit holding the layout is the next one
+        SFChartPhaseMeasureNextCommit(self, numberOfPoints, _performanceObserver, &_measuresCommit);
+    } else {
+        [self invalidateLayout:SFGraphChartViewInvalidationData];
+    }
+    
+    [self _axInvalidateAccessibilityElements];
+}
+
+- (void)applyUpdatesForPlotIndex:(NSInteger)plotIndex
+                  deletedIndexes:(NSIndexSet *)deletedIndexes
+                 insertedIndexes:(NSIndexSet *)insertedIndexes
+                 reloadedIndexes:(NSIndexSet *)reloadedIndexes {
+    SFGraphChartPlotBuffer *plotBuffer = _plotBuffers[plotIndex];
+    [plotBuffer removePaddingValues];
+    
+    NSInteger previousNumberOfPoints = plotBuffer.count;
+    NSInteger numberOfPoints = [_dataSource graphChartView:self numberOfDataPointsForPlotIndex:plotIndex];
+    if (numberOfPoints != previousNumberOfPoints - (NSInteger)deletedIndexes.count + (NSInteger)insertedIndexes.count) {
+        @throw [NSException exceptionWithName:NSInternalInconsistencyException
+                                       reason:[NSString stringWithFormat:@"Invalid update: invalid number of points in plot %ld. The number of points after the update (%ld) must be equal to the number of points before the update (%ld), minus the number of deleted points (%lu), plus the number of inserted points (%lu).",
+                                               (long)plotIndex, (long)numberOfPoints, (long)previousNumberOfPoints, (unsigned long)deletedIndexes.count, (unsigned long)insertedIndexes.count]
+                                     userInfo:nil];
+    }
+    if (reloadedIndexes.count > 0 && reloadedIndexes.lastIndex >= (NSUInteger)previousNumberOfPoints) {
+        @throw [NSException exceptionWithName:NSRangeException
+                                       reason:[NSString stringWithFormat:@"Invalid update: reloaded point index %lu beyond bounds [0 .. %ld]", (unsigned long)reloadedIndexes.lastIndex, (long)previousNumberOfPoints - 1]
+                                     userInfo:nil];
+    }
+    
+    // Reloaded indexes refer to the points before the update; map them to their indexes after it
+    NSMutableIndexSet *obtainedIndexes = [insertedIndexes mutableCopy];
+    [reloadedIndexes enumerateIndexesUsingBlock:^(NSUInteger reloadedIndex, BOOL *stop) {
+        if ([deletedIndexes containsIndex:reloadedIndex]) {
+            return;
+        }
+        NSUInteger updatedIndex = reloadedIndex - [deletedIndexes countOfIndexesInRange:NSMakeRange(0, reloadedIndex)];
+        for (NSUInteger insertedIndex = insertedIndexes.firstIndex;
+             insertedIndex != NSNotFound && insertedIndex <= updatedIndex;
+             insertedIndex = [insertedIndexes indexGreaterThanIndex:insertedIndex]) {
+            updatedIndex++;
+        }
+        [obtainedIndexes addIndex:updatedIndex];
+    }];
+    
+    [plotBuffer removeValuesAtIndexes:deletedIndexes];
+    [plotBuffer insertUnsetValuesAtIndexes:insertedIndexes];
+    [self replaceDataPointsAtIndexes:obtainedIndexes plotIndex:plotIndex inPlotBuffer:plotBuffer];
 }
 
 - (void)setDataSource:(id<SFGraphChartViewDataSource>)dataSource {
@@ -168,8 +534,7 @@ static const CGFloat ScrubberLabelVerticalPadding = 4.0;
     }
     _referenceLineColor = referenceLineColor;
     _horizontalReferenceLineLayer.strokeColor = referenceLineColor.CGColor;
-    [self updateAndLayoutVerticalReferenceLineLayers];
-    [self updatePlotColors];
+    [self invalidateLayout:(SFGraphChartViewInvalidationReferenceLines | SFGraphChartViewInvalidationAppearance)];
 }
 
 - (void)setScrubberLineColor:(UIColor *)scrubberLineColor {
@@ -211,28 +576,34 @@ static const CGFloat ScrubberLabelVerticalPadding = 4.0;
 - (void)setDecimalPlaces:(NSUInteger)decimalPlaces {
     _decimalPlaces = decimalPlaces;
     _decimalFormat = [NSString stringWithFormat:@"%%.%luf", (unsigned long)_decimalPlaces];
+    _scrubberLabelValue = NAN;
     [_yAxisView setDecimalPlaces:_decimalPlaces];
 }
 
 - (void)setShowsHorizontalReferenceLines:(BOOL)showsHorizontalReferenceLines {
     _showsHorizontalReferenceLines = showsHorizontalReferenceLines;
     [self updateHorizontalReferenceLines];
-    [self layoutHorizontalReferenceLineLayers];
+    [self invalidateLayout:SFGraphChartViewInvalidationReferenceLines];
 }
 
 - (void)setShowsVerticalReferenceLines:(BOOL)showsVerticalReferenceLines {
     _showsVerticalReferenceLines = showsVerticalReferenceLines;
-    [self updateAndLayoutVerticalReferenceLineLayers];
+    [self invalidateLayout:SFGraphChartViewInvalidationReferenceLines];
 }
 
 - (void)sharedInit {
     _numberOfXAxisPoints = -1;
     _showsHorizontalReferenceLines = NO;
     _showsVerticalReferenceLines = NO;
-    _dataPoints = [NSMutableArray new];
-    _yAxisPoints = [NSMutableArray new];
+    _plotBuffers = [NSMutableArray new];
+    _batchDeletedIndexes = [NSMutableDictionary new];
+    _batchInsertedIndexes = [NSMutableDictionary new];
+    _batchReloadedIndexes = [NSMutableDictionary new];
     _lineLayers = [NSMutableArray new];
+    _reusableLineLayers = [NSMutableArray new];
+    _invalidation = SFGraphChartViewInvalidationAll;
     _hasDataPoints = NO;
+    _renderingComplexityBudget = DefaultRenderingComplexityBudget;
     
     // init null resetable properties
     _axisColor =  SFColor(SFGraphAxisColorKey);
@@ -254,6 +625,21 @@ static const CGFloat ScrubberLabelVerticalPadding = 4.0;
     _panGestureRecognizer.delegate = self;
     [self addGestureRecognizer:_panGestureRecognizer];
     
+    _tapGestureRecognizer = [[UITapGestureRecognizer alloc] initWithTarget:self action:@selector(handleSelectionGesture:)];
+    _tapGestureRecognizer.delegate = self;
+    [self addGestureRecognizer:_tapGestureRecognizer];
+    
+    _pinchGestureRecognizer = [[UIPinchGestureRecognizer alloc] initWithTarget:self action:@selector(handleZoomingGesture:)];
+    _pinchGestureRecognizer.delegate = self;
+    _pinchGestureRecognizer.enabled = NO;
+    [self addGestureRecognizer:_pinchGestureRecognizer];
+    
+    _zoomingPanGestureRecognizer = [[UIPanGestureRecognizer alloc] initWithTarget:self action:@selector(handleZoomingGesture:)];
+    _zoomingPanGestureRecognizer.minimumNumberOfTouches = 2;
+    _zoomingPanGestureRecognizer.delegate = self;
+    _zoomingPanGestureRecognizer.enabled = NO;
+    [self addGestureRecognizer:_zoomingPanGestureRecognizer];
+    
     [self setUpViews];
     
     [self updateContentSizeCategoryFonts];
@@ -270,11 +656,13 @@ static const CGFloat ScrubberLabelVerticalPadding = 4.0;
 
 - (void)dealloc {
     [[NSNotificationCenter defaultCenter] removeObserver:self];
+    free(_xAxisPositions);
+    free(_scrubbingValues);
 }
 
 - (void)tintColorDidChange {
     _xAxisView.tintColor = self.tintColor;
-    [self updatePlotColors];
+    [self invalidateLayout:SFGraphChartViewInvalidationAppearance];
 }
 
 - (UIColor *)colorForPlotIndex:(NSInteger)plotIndex subpointIndex:(NSInteger)subpointIndex totalSubpoints:(NSInteger)totalSubpoints {
@@ -293,6 +681,11 @@ static const CGFloat ScrubberLabelVerticalPadding = 4.0;
 }
 
 - (void)updatePlotColors {
+    if (_usesTiledRendering) {
+        // The colors are drawn into the tiles
+        _hasValidTiles = NO;
+        [self layoutTiles];
+    }
     for (NSUInteger plotIndex = 0; plotIndex < _lineLayers.count; plotIndex++) {
         [self updatePlotColorsForPlotIndex:plotIndex];
     }
@@ -314,6 +707,7 @@ static const CGFloat ScrubberLabelVerticalPadding = 4.0;
     _xAxisView.titleFont = [UIFont preferredFontForTextStyle:UIFontTextStyleCaption1];
     _yAxisView.titleFont = [UIFont preferredFontForTextStyle:UIFontTextStyleCaption2];
     _scrubberLabel.font = [UIFont preferredFontForTextStyle:UIFontTextStyleCaption1];
+    _scrubberLabelValue = NAN;
     _noDataLabel.font = [UIFont preferredFontForTextStyle:UIFontTextStyleHeadline];
 }
 
@@ -407,39 +801,52 @@ SF_INLINE CALayer *graphVerticalReferenceLineLayerWithColor(UIColor *color, CGFl
 }
 
 - (void)obtainDataPoints {
-    [_dataPoints removeAllObjects];
     _hasDataPoints = NO;
     
     NSInteger numberOfPlots = [self numberOfPlots];
+    if (_plotBuffers.count > numberOfPlots) {
+        [_plotBuffers removeObjectsInRange:NSMakeRange(numberOfPlots, _plotBuffers.count - numberOfPlots)];
+    }
     for (NSInteger plotIndex = 0; plotIndex < numberOfPlots; plotIndex++) {
         [self obtainDataPointsForPlotIndex:plotIndex];
     }
 }
-        
+
 - (void)obtainDataPointsForPlotIndex:(NSInteger)plotIndex {
-    [self.dataPoints addObject:[NSMutableArray new]];
-    NSInteger numberOfPoints = [self.dataSource graphChartView:self numberOfDataPointsForPlotIndex:plotIndex];
-        for (NSInteger pointIndex = 0; pointIndex < numberOfPoints; pointIndex++) {
-        NSObject<SFValueCollectionType> *value = [self dataPointForPointIndex:pointIndex plotIndex:plotIndex];
-        [self.dataPoints[plotIndex] addObject:value];
-            if (!value.isUnset) {
-            self.hasDataPoints = YES;
-            }
-        }
-        // Add dummy points for empty data points
-    NSInteger emptyPointsCount = self.numberOfXAxisPoints - self.dataPoints[plotIndex].count;
-        for (NSInteger idx = 0; idx < emptyPointsCount; idx++) {
-        [self.dataPoints[plotIndex] addObject:[self dummyPoint]];
+    // Reuse the plot buffers of the previous reload so their storage is not reallocated
+    SFGraphChartPlotBuffer *plotBuffer = nil;
+    if (plotIndex < _plotBuffers.count) {
+        plotBuffer = _plotBuffers[plotIndex];
+        [plotBuffer removeAllValues];
+    } else {
+        plotBuffer = [[SFGraphChartPlotBuffer alloc] initWithCapacity:self.numberOfXAxisPoints];
+        [_plotBuffers addObject:plotBuffer];
+    }
+    [self fillPlotBuffer:plotBuffer forPlotIndex:plotIndex];
+    
+    if (plotBuffer.numberOfValidValues > 0) {
+        self.hasDataPoints = YES;
     }
 }
 
+- (void)fillPlotBuffer:(SFGraphChartPlotBuffer *)plotBuffer forPlotIndex:(NSInteger)plotIndex {
+    NSInteger numberOfPoints = [self.dataSource graphChartView:self numberOfDataPointsForPlotIndex:plotIndex];
+    NSInteger numberOfXAxisPoints = self.numberOfXAxisPoints;
+    
+    // Only the most recent points fit when the number of x axis points is capped, as when streaming
+    NSInteger location = MAX(0, numberOfPoints - numberOfXAxisPoints);
+    [self appendDataPointsInRange:NSMakeRange(location, numberOfPoints - location) plotIndex:plotIndex toPlotBuffer:plotBuffer];
+    // Add unset points for empty data points
+    [plotBuffer padWithUnsetValuesToCount:numberOfXAxisPoints];
+}
+
 #pragma mark - Layout & Drawing
 
 - (void)setBounds:(CGRect)bounds {
     BOOL sizeChanged = !CGSizeEqualToSize(bounds.size, self.bounds.size);
     [super setBounds:bounds];
     if (sizeChanged) {
-        [self setNeedsLayout];
+        [self invalidateLayout:(SFGraphChartViewInvalidationPlotGeometry | SFGraphChartViewInvalidationReferenceLines)];
     }
 }
 
@@ -447,10 +854,15 @@ SF_INLINE CALayer *graphVerticalReferenceLineLayerWithColor(UIColor *color, CGFl
     BOOL sizeChanged = !CGSizeEqualToSize(frame.size, self.frame.size);
     [super setFrame:frame];
     if (sizeChanged) {
-        [self setNeedsLayout];
+        [self invalidateLayout:(SFGraphChartViewInvalidationPlotGeometry | SFGraphChartViewInvalidationReferenceLines)];
     }
 }
 
+- (void)invalidateLayout:(SFGraphChartViewInvalidation)invalidation {
+    _invalidation |= invalidation;
+    [self setNeedsLayout];
+}
+
 - (void)layoutSubviews {
     [super layoutSubviews];
     
@@ -472,8 +884,19 @@ SF_INLINE CALayer *graphVerticalReferenceLineLayerWithColor(UIColor *color, CGFl
                                   YAxisViewWidth,
                                   CGRectGetHeight(_plotView.frame));
     
-    [self layoutHorizontalReferenceLineLayers];
-    [self updateAndLayoutVerticalReferenceLineLayers];
+    // Only redo the invalidated stages, as layout passes are also triggered by the scrubber
+    SFGraphChartViewInvalidation invalidation = _invalidation;
+    _invalidation = 0;
+    if (!CGSizeEqualToSize(plotViewFrame.size, _laidOutPlotViewSize)) {
+        // Covers resizes which did not go through setBounds: or setFrame:
+        invalidation |= (SFGraphChartViewInvalidationPlotGeometry | SFGraphChartViewInvalidationReferenceLines);
+        _laidOutPlotViewSize = plotViewFrame.size;
+    }
+    
+    if (invalidation & SFGraphChartViewInvalidationReferenceLines) {
+        [self layoutHorizontalReferenceLineLayers];
+        [self updateAndLayoutVerticalReferenceLineLayers];
+    }
     
     if (_noDataLabel) {
         _noDataLabel.frame = CGRectMake(0,
@@ -488,16 +911,108 @@ SF_INLINE CALayer *graphVerticalReferenceLineLayerWithColor(UIColor *color, CGFl
                                      1,
                                      CGRectGetHeight(_plotView.frame));
     
-    [self updateYAxisPoints];
+    if (invalidation & (SFGraphChartViewInvalidationData | SFGraphChartViewInvalidationPlotGeometry)) {
+        // The points adjacent to the visible range are drawn past the plot view edges
+        _plotView.clipsToBounds = ([self visibleXAxisPointRange].length < self.numberOfXAxisPoints);
+        NSInteger numberOfPoints = numberOfBufferedPoints(_plotBuffers);
+        if (_usesTiledRendering != [self shouldUseTiledRendering]) {
+            // Zooming or resizing changed the number of drawn points enough to switch the rendering mode
+            [self updatePlotLayers];
+        }
+        
+        SFChartPhaseInterval interval = SFChartPhaseBegin(self, SFChartPhaseNormalization);
+        [self updateCanvasValues];
+        SFChartPhaseEnd(self, interval, numberOfPoints, _performanceObserver);
+        
+        interval = SFChartPhaseBegin(self, SFChartPhaseLayout);
+        [self layoutPlotLayers];
+        SFChartPhaseEnd(self, interval, numberOfPoints, _performanceObserver);
+    }
+    if (invalidation & SFGraphChartViewInvalidationAppearance) {
+        [self updatePlotColors];
+    }
+}
+
+- (void)layoutPlotLayers {
     [self layoutLineLayers];
 }
 
-- (void)updateYAxisPoints {
-    [_yAxisPoints removeAllObjects];
+- (void)updatePlotLayers {
+    [self updateLineLayers];
+}
+
+- (void)updateCanvasValues {
+    CGFloat canvasHeight = _plotView.bounds.size.height;
+    if (canvasHeight != _canvasHeight) {
+        _canvasHeight = canvasHeight;
+        [self invalidateCanvasValues];
+    }
+    
+    // Only normalize the plots whose values changed since they were last normalized, and only the
+    // points which are not culled
+    NSInteger numberOfPlots = MIN([self numberOfPlots], (NSInteger)_plotBuffers.count);
+    for (NSInteger plotIndex = 0; plotIndex < numberOfPlots; plotIndex++) {
+        NSRange culledRange = [self culledXAxisPointRangeForPlotIndex:plotIndex];
+        if (![_plotBuffers[plotIndex] hasCanvasValuesInRange:culledRange]) {
+            [self normalizeCanvasValuesForPlotIndex:plotIndex canvasHeight:canvasHeight];
+            _plotBuffers[plotIndex].canvasValuesRange = culledRange;
+            _plotBuffers[plotIndex].hasCanvasValues = YES;
+        }
+    }
+}
+
+- (void)normalizeCanvasValuesForPlotIndex:(NSInteger)plotIndex canvasHeight:(CGFloat)viewHeight {
+    if (plotIndex < _plotBuffers.count) {
+        [_plotBuffers[plotIndex] normalizeCanvasValuesInRange:[self culledXAxisPointRangeForPlotIndex:plotIndex]
+                                                 minimumValue:self.minimumValue
+                                                 maximumValue:self.maximumValue
+                                                 canvasHeight:viewHeight];
+    }
+}
+
+- (void)calculateMinAndMaxValues {
+    double minimumValue = SFDoubleInvalidValue;
+    double maximumValue = SFDoubleInvalidValue;
+    [self getProvidedMinimumValue:&minimumValue maximumValue:&maximumValue];
+    resolveValueLimitsOfPlotBuffers(_plotBuffers, [self visibleXAxisPointRange], &minimumValue, &maximumValue);
+    self.minimumValue = minimumValue;
+    self.maximumValue = maximumValue;
+}
+
+- (void)getProvidedMinimumValue:(double *)minimumValue maximumValue:(double *)maximumValue {
+    *minimumValue = SFDoubleInvalidValue;
+    *maximumValue = SFDoubleInvalidValue;
+    if ([_dataSource respondsToSelector:@selector(minimumValueForGraphChartView:)]) {
+        *minimumValue = [_dataSource minimumValueForGraphChartView:self];
+    }
+    if ([_dataSource respondsToSelector:@selector(maximumValueForGraphChartView:)]) {
+        *maximumValue = [_dataSource maximumValueForGraphChartView:self];
+    }
+}
+
+- (void)valueRangeDidChange {
+    [_yAxisView updateTicksAndLabels];
+    [self invalidateCanvasValues];
+    [self invalidateLayout:SFGraphChartViewInvalidationData];
+}
+
+- (void)invalidateCanvasValues {
+    for (SFGraphChartPlotBuffer *plotBuffer in _plotBuffers) {
+        plotBuffer.hasCanvasValues = NO;
+    }
+}
+
+- (BOOL)hasCanvasValues {
     NSInteger numberOfPlots = [self numberOfPlots];
+    if (_plotBuffers.count != numberOfPlots) {
+        return NO;
+    }
     for (NSInteger plotIndex = 0; plotIndex < numberOfPlots; plotIndex++) {
-        [_yAxisPoints addObject:[self normalizedCanvasDataPointsForPlotIndex:plotIndex canvasHeight:_plotView.bounds.size.height]];
+        if (![_plotBuffers[plotIndex] hasCanvasValuesInRange:[self culledXAxisPointRangeForPlotIndex:plotIndex]]) {
+            return NO;
+        }
     }
+    return YES;
 }
 
 - (void)layoutHorizontalReferenceLineLayers {
@@ -519,12 +1034,12 @@ SF_INLINE CALayer *graphVerticalReferenceLineLayerWithColor(UIColor *color, CGFl
         _verticalReferenceLineLayers = [NSMutableArray new];
         CGFloat plotViewHeight = _plotView.bounds.size.height;
         CGFloat plotViewWidth = _plotView.bounds.size.width;
-        NSInteger numberOfXAxisPoints = self.numberOfXAxisPoints;
-        for (NSUInteger pointIndex = 1; pointIndex < numberOfXAxisPoints; pointIndex++) {
+        NSRange visibleRange = [self visibleXAxisPointRange];
+        for (NSUInteger pointIndex = visibleRange.location + 1; pointIndex < NSMaxRange(visibleRange); pointIndex++) {
             if (![_dataSource respondsToSelector:@selector(graphChartView:drawsVerticalReferenceLineAtPointIndex:)]
                 || [_dataSource graphChartView:self drawsVerticalReferenceLineAtPointIndex:pointIndex]) {
                 CALayer *verticalReferenceLineLayer = graphVerticalReferenceLineLayerWithColor(_referenceLineColor, plotViewHeight);
-                CGFloat positionOnXAxis = xAxisPoint(pointIndex, self.numberOfXAxisPoints, plotViewWidth);
+                CGFloat positionOnXAxis = xAxisPointInRange(pointIndex, visibleRange, plotViewWidth);
                 verticalReferenceLineLayer.position = CGPointMake(positionOnXAxis - scalePixelAdjustment(), 0);
                 [_referenceLinesView.layer insertSublayer:verticalReferenceLineLayer atIndex:0];
                 [_verticalReferenceLineLayers addObject:verticalReferenceLineLayer];
@@ -535,7 +1050,7 @@ SF_INLINE CALayer *graphVerticalReferenceLineLayerWithColor(UIColor *color, CGFl
 
 SF_INLINE UIImage *graphPointLayerImageWithColor(UIColor *color) {
     const CGFloat pointSize = SFGraphChartViewPointAndLineWidth;
-    const CGFloat pointLineWidth = 2.0;
+    const CGFloat pointLineWidth = SFGraphChartViewPointIndicatorLineWidth;
     
     static UIImage *pointImage = nil;
     static UIColor *pointImageColor = nil;
@@ -560,6 +1075,7 @@ SF_INLINE UIImage *graphPointLayerImageWithColor(UIColor *color) {
 SF_INLINE CALayer *graphPointLayerWithColor(UIColor *color, BOOL drawPointIndicator) {
     const CGFloat pointSize = SFGraphChartViewPointAndLineWidth;
     CALayer *pointLayer = [CALayer new];
+    SFChartNoteAllocatedLayer();
     pointLayer.frame = (CGRect){{0, 0}, {pointSize, pointSize}};
     if (drawPointIndicator) {
     pointLayer.contents = (__bridge id)(graphPointLayerImageWithColor(color).CGImage);
@@ -567,13 +1083,22 @@ SF_INLINE CALayer *graphPointLayerWithColor(UIColor *color, BOOL drawPointIndica
     
     return pointLayer;
     }
+
+SF_INLINE CAShapeLayer *graphPointPathLayerWithColor(UIColor *color) {
+    CAShapeLayer *pointPathLayer = [CAShapeLayer layer];
+    SFChartNoteAllocatedLayer();
+    pointPathLayer.fillColor = [UIColor whiteColor].CGColor;
+    pointPathLayer.strokeColor = color.CGColor;
+    pointPathLayer.lineWidth = SFGraphChartViewPointIndicatorLineWidth;
+    return pointPathLayer;
+}
     
 - (BOOL)shouldDrawPointIndicatorForPointWithIndex:(NSInteger)pointIndex inPlotWithIndex:(NSInteger)plotIndex {
-    SFValueRange *dataPoint = (SFValueRange *)_dataPoints[plotIndex][pointIndex];
-    if (dataPoint.isUnset) {
+    SFGraphChartPlotBuffer *plotBuffer = _plotBuffers[plotIndex];
+    if ([plotBuffer isUnsetAtIndex:pointIndex]) {
         return NO;
     }
-    if (!dataPoint.isEmptyRange) {
+    if (plotBuffer.minimumValues[pointIndex] != plotBuffer.maximumValues[pointIndex]) {
         return YES;
     }
     if ([self isKindOfClass:[SFLineGraphChartView class]]
@@ -583,33 +1108,113 @@ SF_INLINE CALayer *graphPointLayerWithColor(UIColor *color, BOOL drawPointIndica
     return YES;
 }
 
+- (CAShapeLayer *)dequeueReusableLineLayer {
+    CAShapeLayer *lineLayer = _reusableLineLayers.lastObject;
+    if (!lineLayer) {
+        SFChartNoteAllocatedLayer();
+        return [CAShapeLayer layer];
+    }
+    [_reusableLineLayers removeLastObject];
+    
+    // Restore the defaults of a new layer
+    [lineLayer removeAllAnimations];
+    lineLayer.path = NULL;
+    lineLayer.fillColor = [UIColor blackColor].CGColor;
+    lineLayer.strokeColor = NULL;
+    lineLayer.lineWidth = 1.0;
+    lineLayer.lineCap = kCALineCapButt;
+    lineLayer.lineJoin = kCALineJoinMiter;
+    lineLayer.lineDashPattern = nil;
+    lineLayer.strokeStart = 0.0;
+    lineLayer.strokeEnd = 1.0;
+    lineLayer.opacity = 1.0;
+    return lineLayer;
+}
+
+- (void)enqueueReusableLineLayer:(CAShapeLayer *)lineLayer {
+    [_reusableLineLayers addObject:lineLayer];
+}
+
+- (void)enqueueReusableLineLayersForPlotIndex:(NSInteger)plotIndex {
+    for (NSMutableArray<CAShapeLayer *> *sublineLayers in _lineLayers[plotIndex]) {
+        [_reusableLineLayers addObjectsFromArray:sublineLayers];
+    }
+    [_lineLayers[plotIndex] removeAllObjects];
+}
+
+- (void)removeUnusedReusableLineLayers {
+    // Reusable layers stay in the plot view during an update, so only the surplus is removed, and then
+    // released rather than kept for the lifetime of the view
+    [_reusableLineLayers makeObjectsPerformSelector:@selector(removeFromSuperlayer)];
+    [_reusableLineLayers removeAllObjects];
+}
+
 - (void)updateLineLayers {
+    _usesTiledRendering = [self shouldUseTiledRendering];
+    [self updateTileRenderer];
+    
+    // Reused layers are reconfigured without implicit animations
+    [CATransaction begin];
+    [CATransaction setDisableActions:YES];
     for (NSInteger plotIndex = 0; plotIndex < _lineLayers.count; plotIndex++) {
-        for (NSMutableArray <CAShapeLayer *> *sublineLayers in self.lineLayers[plotIndex]) {
-            [sublineLayers makeObjectsPerformSelector:@selector(removeFromSuperlayer)];
-        }
+        [self enqueueReusableLineLayersForPlotIndex:plotIndex];
     }
-    [_lineLayers removeAllObjects];
     
     NSInteger numberOfPlots = [self numberOfPlots];
+    if (_lineLayers.count > numberOfPlots) {
+        [_lineLayers removeObjectsInRange:NSMakeRange(numberOfPlots, _lineLayers.count - numberOfPlots)];
+    }
     for (NSInteger plotIndex = 0; plotIndex < numberOfPlots; plotIndex++) {
         // Add array even if it should not draw lines so all layer arays have the same number of elements for animating purposes
-        NSMutableArray<NSMutableArray<CAShapeLayer *> *> *currentPlotLineLayers = [NSMutableArray new];
-        [_lineLayers addObject:currentPlotLineLayers];
-        if ([self shouldDrawLinesForPlotIndex:plotIndex]) {
+        if (plotIndex == _lineLayers.count) {
+            [_lineLayers addObject:[NSMutableArray new]];
+        }
+        if (!_usesTiledRendering && [self shouldDrawLinesForPlotIndex:plotIndex]) {
             [self updateLineLayersForPlotIndex:plotIndex];
         }
     }
+    [self removeUnusedReusableLineLayers];
+    [CATransaction commit];
+}
+
+- (void)updateLineLayersReplacingExistingForPlotIndex:(NSInteger)plotIndex {
+    [CATransaction begin];
+    [CATransaction setDisableActions:YES];
+    [self enqueueReusableLineLayersForPlotIndex:plotIndex];
+    if (_usesTiledRendering) {
+        _hasValidTiles = NO;
+    } else if ([self shouldDrawLinesForPlotIndex:plotIndex]) {
+        [self updateLineLayersForPlotIndex:plotIndex];
+    }
+    [self removeUnusedReusableLineLayers];
+    [CATransaction commit];
+}
+
+- (void)updatePlotLayersForPlotIndex:(NSInteger)plotIndex {
+    [self updateLineLayersReplacingExistingForPlotIndex:plotIndex];
+}
+
+- (void)layoutPlotLayersForPlotIndex:(NSInteger)plotIndex {
+    if (_usesTiledRendering) {
+        [self layoutTiles];
+    } else if ([self shouldDrawLinesForPlotIndex:plotIndex]) {
+        [self layoutLineLayersForPlotIndex:plotIndex];
+    }
 }
 
 - (void)layoutLineLayers {
     
-    NSInteger numberOfPlots = [self numberOfPlots];
-    if (_yAxisPoints.count != numberOfPlots) {
+    if (![self hasCanvasValues]) {
         // avoid layout if points have not been normalized yet
         return;
     }
     
+    if (_usesTiledRendering) {
+        [self layoutTiles];
+        return;
+    }
+    
+    NSInteger numberOfPlots = [self numberOfPlots];
     for (NSInteger plotIndex = 0; plotIndex < numberOfPlots; plotIndex++) {
         if ([self shouldDrawLinesForPlotIndex:plotIndex]) {
             [self layoutLineLayersForPlotIndex:plotIndex];
@@ -635,6 +1240,119 @@ SF_INLINE CALayer *graphPointLayerWithColor(UIColor *color, BOOL drawPointIndica
     return 0;
 }
 
+#pragma mark - Tiled Rendering
+
+- (void)setRenderingComplexityBudget:(NSInteger)renderingComplexityBudget {
+    _renderingComplexityBudget = renderingComplexityBudget;
+    if (_usesTiledRendering != [self shouldUseTiledRendering]) {
+        [self updatePlotLayers];
+        [self invalidateLayout:SFGraphChartViewInvalidationData];
+    }
+}
+
+- (NSInteger)renderingComplexityForPlotIndex:(NSInteger)plotIndex {
+    return [self culledXAxisPointRangeForPlotIndex:plotIndex].length;
+}
+
+- (BOOL)shouldUseTiledRendering {
+    if (_renderingComplexityBudget <= 0) {
+        return NO;
+    }
+    NSInteger renderingComplexity = 0;
+    NSInteger numberOfPlots = MIN([self numberOfPlots], (NSInteger)_plotBuffers.count);
+    for (NSInteger plotIndex = 0; plotIndex < numberOfPlots; plotIndex++) {
+        renderingComplexity += [self renderingComplexityForPlotIndex:plotIndex];
+    }
+    // Tiled plots only switch back well under the budget, so plots around it do not switch on every zoom
+    NSInteger budget = _usesTiledRendering ? _renderingComplexityBudget / 2 : _renderingComplexityBudget;
+    return renderingComplexity > budget;
+}
+
+- (void)updateTileRenderer {
+    if (_usesTiledRendering) {
+        if (!_tileRenderer) {
+            _tileRenderer = [[SFGraphChartTileRenderer alloc] initWithHostLayer:_plotView.layer];
+        }
+        _hasValidTiles = NO;
+    } else if (_tileRenderer) {
+        [_tileRenderer removeAllTiles];
+        _tileRenderer = nil;
+    }
+}
+
+- (void)invalidateTiles {
+    _hasValidTiles = NO;
+}
+
+- (nullable const CGFloat *)tileXPositionsForPlotIndex:(NSInteger)plotIndex {
+    return NULL;
+}
+
+- (void)layoutTiles {
+    CGSize canvasSize = _plotView.bounds.size;
+    NSRange visibleRange = [self visibleXAxisPointRange];
+    if (!_hasValidTiles || _tiledMinimumValue != self.minimumValue || _tiledMaximumValue != self.maximumValue
+        || !CGSizeEqualToSize(canvasSize, _tiledCanvasSize) || _tiledNumberOfVisibleXAxisPoints != visibleRange.length) {
+        // Panning keeps the tiles unless the value range adapts to the visible points
+        _tileRenderer.drawingBlock = [self tileDrawingBlockWithCanvasSize:canvasSize numberOfVisibleXAxisPoints:visibleRange.length];
+        _tiledMinimumValue = self.minimumValue;
+        _tiledMaximumValue = self.maximumValue;
+        _tiledCanvasSize = canvasSize;
+        _tiledNumberOfVisibleXAxisPoints = visibleRange.length;
+        _hasValidTiles = YES;
+    }
+    CGFloat contentOffset = 0;
+    CGFloat contentWidth = canvasSize.width;
+    if (_tilesFollowVisibleRange) {
+        contentOffset = xAxisPoint(visibleRange.location, visibleRange.length, canvasSize.width);
+        contentWidth = xAxisPoint(MAX(self.numberOfXAxisPoints - 1, 0), visibleRange.length, canvasSize.width);
+    }
+    [_tileRenderer layoutTilesWithContentOffset:contentOffset visibleSize:canvasSize contentWidth:contentWidth];
+}
+
+- (SFGraphChartTileDrawingBlock)tileDrawingBlockWithCanvasSize:(CGSize)canvasSize numberOfVisibleXAxisPoints:(NSInteger)numberOfVisibleXAxisPoints {
+    NSMutableArray<SFGraphChartTileDrawingBlock> *plotDrawingBlocks = [NSMutableArray new];
+    NSMutableArray<NSData *> *xPositionData = [NSMutableArray new];
+    _tilesFollowVisibleRange = YES;
+    NSInteger numberOfPlots = MIN([self numberOfPlots], (NSInteger)_plotBuffers.count);
+    for (NSInteger plotIndex = 0; plotIndex < numberOfPlots; plotIndex++) {
+        SFGraphChartTileGeometry geometry = {
+            .minimumValue = self.minimumValue,
+            .maximumValue = self.maximumValue,
+            .canvasHeight = canvasSize.height,
+            .xAxisPointWidth = canvasSize.width / MAX(1, numberOfVisibleXAxisPoints - 1),
+            .xPositions = NULL,
+            .numberOfPoints = [self numberOfCanvasXPositionsForPlotIndex:plotIndex],
+            .xOffset = [self xOffsetForPlotIndex:plotIndex],
+            .pointMargin = 0,
+        };
+        const CGFloat *xPositions = [self tileXPositionsForPlotIndex:plotIndex];
+        if (xPositions) {
+            // The positions are copied, as they are recalculated on the main thread
+            NSData *positionData = [NSData dataWithBytes:xPositions length:geometry.numberOfPoints * sizeof(CGFloat)];
+            [xPositionData addObject:positionData];
+            geometry.xPositions = positionData.bytes;
+            _tilesFollowVisibleRange = NO;
+        }
+        SFGraphChartTileDrawingBlock plotDrawingBlock = [self tileDrawingBlockForPlotIndex:plotIndex geometry:geometry];
+        if (plotDrawingBlock) {
+            [plotDrawingBlocks addObject:plotDrawingBlock];
+        }
+    }
+    
+    NSArray<SFGraphChartTileDrawingBlock> *drawingBlocks = [plotDrawingBlocks copy];
+    NSArray<NSData *> *retainedXPositionData = [xPositionData copy];
+    return ^(CGContextRef context, CGRect rect) {
+        // The geometries point into the position data, which lives as long as the block
+        (void)retainedXPositionData;
+        for (SFGraphChartTileDrawingBlock drawingBlock in drawingBlocks) {
+            CGContextSaveGState(context);
+            drawingBlock(context, rect);
+            CGContextRestoreGState(context);
+        }
+    };
+}
+
 #pragma mark - Plotting Points
 
 - (NSInteger)numberOfPlots {
@@ -668,6 +1386,94 @@ SF_INLINE CALayer *graphPointLayerWithColor(UIColor *color, BOOL drawPointIndica
     return _numberOfXAxisPoints;
 }
 
+#pragma mark - Visible Range
+
+- (void)setVisibleXAxisRange:(NSRange)visibleXAxisRange {
+    if (NSEqualRanges(visibleXAxisRange, _visibleXAxisRange)) {
+        return;
+    }
+    _visibleXAxisRange = visibleXAxisRange;
+    [self visibleXAxisRangeDidChange];
+}
+
+- (void)visibleXAxisRangeDidChange {
+    [_xAxisView updateTitles];
+    
+    // The value range adapts to the visible points unless provided by the data source
+    double minimumValue = self.minimumValue;
+    double maximumValue = self.maximumValue;
+    [self calculateMinAndMaxValues];
+    if (minimumValue != self.minimumValue || maximumValue != self.maximumValue) {
+        [self valueRangeDidChange];
+    }
+    
+    // Points entering the visible range are normalized on the next layout pass
+    [self invalidateLayout:(SFGraphChartViewInvalidationPlotGeometry | SFGraphChartViewInvalidationReferenceLines)];
+}
+
+- (NSRange)visibleXAxisPointRange {
+    return [self visibleXAxisPointRangeForNumberOfXAxisPoints:self.numberOfXAxisPoints];
+}
+
+- (NSRange)visibleXAxisPointRangeForNumberOfXAxisPoints:(NSInteger)numberOfXAxisPoints {
+    if (_visibleXAxisRange.length == 0) {
+        return NSMakeRange(0, numberOfXAxisPoints);
+    }
+    NSInteger length = MIN(MAX((NSInteger)_visibleXAxisRange.length, MinimumNumberOfVisibleXAxisPoints), numberOfXAxisPoints);
+    NSInteger location = MIN((NSInteger)_visibleXAxisRange.location, numberOfXAxisPoints - length);
+    return NSMakeRange(location, length);
+}
+
+- (NSRange)culledXAxisPointRangeForPlotIndex:(NSInteger)plotIndex {
+    NSInteger pointCount = (plotIndex < _plotBuffers.count) ? _plotBuffers[plotIndex].count : 0;
+    NSRange visibleRange = [self visibleXAxisPointRange];
+    if (visibleRange.length >= self.numberOfXAxisPoints) {
+        return NSMakeRange(0, pointCount);
+    }
+    NSInteger startIndex = MAX(0, (NSInteger)visibleRange.location - CulledRangeMargin);
+    NSInteger endIndex = MIN(pointCount, (NSInteger)NSMaxRange(visibleRange) + CulledRangeMargin);
+    return NSMakeRange(startIndex, MAX(0, endIndex - startIndex));
+}
+
+- (void)setZoomingEnabled:(BOOL)zoomingEnabled {
+    _zoomingEnabled = zoomingEnabled;
+    _pinchGestureRecognizer.enabled = zoomingEnabled;
+    _zoomingPanGestureRecognizer.enabled = zoomingEnabled;
+    // Leave two-finger pans to zooming
+    _panGestureRecognizer.maximumNumberOfTouches = zoomingEnabled ? 1 : NSUIntegerMax;
+}
+
+- (void)handleZoomingGesture:(UIGestureRecognizer *)gestureRecognizer {
+    NSInteger numberOfXAxisPoints = self.numberOfXAxisPoints;
+    CGFloat plotViewWidth = CGRectGetWidth(_plotView.bounds);
+    if (numberOfXAxisPoints <= MinimumNumberOfVisibleXAxisPoints || plotViewWidth <= 0) {
+        return;
+    }
+    if (gestureRecognizer.state == UIGestureRecognizerStateBegan) {
+        _zoomingGestureStartRange = [self visibleXAxisPointRange];
+    } else if (gestureRecognizer.state != UIGestureRecognizerStateChanged) {
+        return;
+    }
+    
+    NSRange startRange = _zoomingGestureStartRange;
+    double location = startRange.location;
+    NSInteger length = startRange.length;
+    if (gestureRecognizer == _pinchGestureRecognizer) {
+        // Keep the x-axis position under the pinch at the same place in the plot view
+        CGFloat scale = MAX(_pinchGestureRecognizer.scale, 0.01);
+        double anchorFraction = MAX(MIN([gestureRecognizer locationInView:_plotView].x / plotViewWidth, 1.0), 0.0);
+        double anchorPointIndex = startRange.location + anchorFraction * (startRange.length - 1);
+        length = (NSInteger)round((startRange.length - 1) / scale) + 1;
+        length = MIN(MAX(length, MinimumNumberOfVisibleXAxisPoints), numberOfXAxisPoints);
+        location = anchorPointIndex - anchorFraction * (length - 1);
+    } else {
+        CGFloat xAxisPointWidth = plotViewWidth / MAX(1, startRange.length - 1);
+        location -= [_zoomingPanGestureRecognizer translationInView:_plotView].x / xAxisPointWidth;
+    }
+    location = MIN(MAX(round(location), 0), numberOfXAxisPoints - length);
+    self.visibleXAxisRange = NSMakeRange((NSUInteger)location, length);
+}
+
 #pragma Mark - Scrubbing
 
 - (NSInteger)scrubbingPlotIndex {
@@ -688,7 +1494,10 @@ SF_INLINE CALayer *graphPointLayerWithColor(UIColor *color, BOOL drawPointIndica
     if (fabs(translation.x) > fabs(translation.y)) {
             shouldBegin = YES;
         }
-    } else if (gestureRecognizer == _longPressGestureRecognizer) {
+    } else if (gestureRecognizer == _longPressGestureRecognizer
+               || gestureRecognizer == _tapGestureRecognizer
+               || gestureRecognizer == _pinchGestureRecognizer
+               || gestureRecognizer == _zoomingPanGestureRecognizer) {
         shouldBegin = YES;
     }
     return shouldBegin;
@@ -696,31 +1505,143 @@ SF_INLINE CALayer *graphPointLayerWithColor(UIColor *color, BOOL drawPointIndica
 
 - (void)handleScrubbingGesture:(UIGestureRecognizer *)gestureRecognizer {
     NSInteger scrubbingPlotIndex = [self scrubbingPlotIndex];
-    if ((_dataPoints.count > scrubbingPlotIndex) && ([self numberOfValidValuesForPlotIndex:scrubbingPlotIndex] > 0)) {
+    if ((_plotBuffers.count > scrubbingPlotIndex) && ([self numberOfValidValuesForPlotIndex:scrubbingPlotIndex] > 0)) {
         
         CGPoint location = [gestureRecognizer locationInView:_plotView];
         CGFloat maxX = round(CGRectGetWidth(_plotView.bounds));
         CGFloat normalizedX = MAX(MIN(location.x, maxX), 0);
         location = CGPointMake(normalizedX, location.y);
         CGFloat snappedXPosition = [self snappedXPosition:location.x plotIndex:scrubbingPlotIndex];
-        [self updateScrubberViewForXPosition:snappedXPosition plotIndex:scrubbingPlotIndex];
         
         if (gestureRecognizer.state == UIGestureRecognizerStateBegan) {
+            // The first update is applied right away, so the scrubber appears under the touch
+            _scrubberXPosition = NAN;
+            _scrubberLabelValue = NAN;
+            [self applyScrubberUpdateForXPosition:snappedXPosition plotIndex:scrubbingPlotIndex notifyDelegate:NO];
+            [self startScrubberDisplayLink];
             [self setScrubberViewsHidden:NO animated:YES];
             if ([_delegate respondsToSelector:@selector(graphChartViewTouchesBegan:)]) {
                 [_delegate graphChartViewTouchesBegan:self];
             }
         } else if (gestureRecognizer.state == UIGestureRecognizerStateChanged) {
-            if ([_delegate respondsToSelector:@selector(graphChartView:touchesMovedToXPosition:)]) {
-                [_delegate graphChartView:self touchesMovedToXPosition:snappedXPosition];
-            }
+            // Applied by the display link, so only the latest update of each frame is laid out
+            _pendingScrubberXPosition = snappedXPosition;
+            _pendingScrubberPlotIndex = scrubbingPlotIndex;
+            _hasPendingScrubberUpdate = YES;
+            _scrubberDisplayLink.paused = NO;
         } else if (gestureRecognizer.state == UIGestureRecognizerStateEnded) {
+            [self applyPendingScrubberUpdate];
+            [self applyScrubberUpdateForXPosition:snappedXPosition plotIndex:scrubbingPlotIndex notifyDelegate:NO];
             [self setScrubberViewsHidden:YES animated:YES];
             if ([_delegate respondsToSelector:@selector(graphChartViewTouchesEnded:)]) {
                 [_delegate graphChartViewTouchesEnded:self];
             }
         }
     }
+    
+    if (gestureRecognizer.state == UIGestureRecognizerStateEnded
+        || gestureRecognizer.state == UIGestureRecognizerStateCancelled
+        || gestureRecognizer.state == UIGestureRecognizerStateFailed) {
+        [self stopScrubberDisplayLink];
+    }
+}
+
+- (void)handleSelectionGesture:(UITapGestureRecognizer *)gestureRecognizer {
+    if (gestureRecognizer.state != UIGestureRecognizerStateEnded || ![self hasCanvasValues]
+        || ![_delegate respondsToSelector:@selector(graphChartView:didSelectPointAtIndex:plotIndex:subpointIndex:)]) {
+        return;
+    }
+    CGPoint location = [gestureRecognizer locationInView:_plotView];
+    NSInteger pointIndex = NSNotFound;
+    NSInteger plotIndex = NSNotFound;
+    NSInteger subpointIndex = NSNotFound;
+    if ([self getSelectedPointIndex:&pointIndex plotIndex:&plotIndex subpointIndex:&subpointIndex atCanvasPoint:location]) {
+        [_delegate graphChartView:self didSelectPointAtIndex:pointIndex plotIndex:plotIndex subpointIndex:subpointIndex];
+    }
+}
+
+- (BOOL)getSelectedPointIndex:(NSInteger *)pointIndex plotIndex:(NSInteger *)plotIndex subpointIndex:(NSInteger *)subpointIndex atCanvasPoint:(CGPoint)point {
+    // Points cannot be selected unless overridden
+    return NO;
+}
+
+- (void)startScrubberDisplayLink {
+    if (!_scrubberDisplayLink) {
+        // The display link retains the chart view, so it only exists while scrubbing
+        _scrubberDisplayLink = [CADisplayLink displayLinkWithTarget:self selector:@selector(scrubberDisplayLinkDidFire:)];
+        [_scrubberDisplayLink addToRunLoop:[NSRunLoop mainRunLoop] forMode:NSRunLoopCommonModes];
+    }
+    _scrubberDisplayLink.paused = YES;
+    _hasPendingScrubberUpdate = NO;
+}
+
+- (void)stopScrubberDisplayLink {
+    [_scrubberDisplayLink invalidate];
+    _scrubberDisplayLink = nil;
+    _hasPendingScrubberUpdate = NO;
+}
+
+- (void)scrubberDisplayLinkDidFire:(CADisplayLink *)displayLink {
+    [self applyPendingScrubberUpdate];
+    // Resumed by the next gesture update, so a resting touch does not wake every frame
+    displayLink.paused = YES;
+}
+
+- (void)applyPendingScrubberUpdate {
+    if (_hasPendingScrubberUpdate) {
+        _hasPendingScrubberUpdate = NO;
+        [self applyScrubberUpdateForXPosition:_pendingScrubberXPosition plotIndex:_pendingScrubberPlotIndex notifyDelegate:YES];
+    }
+}
+
+- (void)applyScrubberUpdateForXPosition:(CGFloat)xPosition plotIndex:(NSInteger)plotIndex notifyDelegate:(BOOL)notifyDelegate {
+    if (xPosition == _scrubberXPosition && plotIndex == _scrubberPlotIndex) {
+        // Still snapped to the same point, so nothing the scrubber shows has changed
+        return;
+    }
+    _scrubberXPosition = xPosition;
+    _scrubberPlotIndex = plotIndex;
+    [self updateScrubberViewForXPosition:xPosition plotIndex:plotIndex];
+    if (notifyDelegate && [_delegate respondsToSelector:@selector(graphChartView:touchesMovedToXPosition:)]) {
+        [_delegate graphChartView:self touchesMovedToXPosition:xPosition];
+    }
+    if (_scrubsAllPlots && [_delegate respondsToSelector:@selector(graphChartView:didScrubToValues:numberOfPlots:)]) {
+        [self reportScrubbingValuesForXPosition:xPosition plotIndex:plotIndex];
+    }
+}
+
+- (void)reportScrubbingValuesForXPosition:(CGFloat)xPosition plotIndex:(NSInteger)plotIndex {
+    NSInteger numberOfPlots = _plotBuffers.count;
+    if (numberOfPlots > _scrubbingValuesCapacity) {
+        SFGraphChartScrubbingValue *scrubbingValues = realloc(_scrubbingValues, numberOfPlots * sizeof(SFGraphChartScrubbingValue));
+        if (scrubbingValues == NULL) {
+            @throw [NSException exceptionWithName:NSMallocException
+                                           reason:@"Unable to allocate the scrubbing values"
+                                         userInfo:nil];
+        }
+        _scrubbingValues = scrubbingValues;
+        _scrubbingValuesCapacity = numberOfPlots;
+    }
+    
+    // Resolved once for the scrubbing plot, then read from the value buffers of every plot
+    NSInteger scrubbedPointIndex = [self pointIndexForXPosition:xPosition plotIndex:plotIndex];
+    for (NSInteger index = 0; index < numberOfPlots; index++) {
+        SFGraphChartPlotBuffer *plotBuffer = _plotBuffers[index];
+        NSInteger pointIndex = [self scrubbedPointIndexForPlotIndex:index xPosition:xPosition scrubbedPointIndex:scrubbedPointIndex];
+        SFGraphChartScrubbingValue scrubbingValue = {NSNotFound, SFDoubleInvalidValue, SFDoubleInvalidValue};
+        if (pointIndex >= 0 && pointIndex < plotBuffer.count) {
+            scrubbingValue.pointIndex = pointIndex;
+            scrubbingValue.minimumValue = plotBuffer.minimumValues[pointIndex];
+            scrubbingValue.maximumValue = plotBuffer.maximumValues[pointIndex];
+        }
+        _scrubbingValues[index] = scrubbingValue;
+    }
+    [_delegate graphChartView:self didScrubToValues:_scrubbingValues numberOfPlots:numberOfPlots];
+}
+
+- (NSInteger)scrubbedPointIndexForPlotIndex:(NSInteger)plotIndex xPosition:(CGFloat)xPosition scrubbedPointIndex:(NSInteger)scrubbedPointIndex {
+    // Every plot is laid out on the same x-axis points
+    return scrubbedPointIndex;
 }
 
 - (void)updateScrubberViewForXPosition:(CGFloat)xPosition plotIndex:(NSInteger)plotIndex {
@@ -761,12 +1682,17 @@ SF_INLINE CALayer *graphPointLayerWithColor(UIColor *color, BOOL drawPointIndica
     double scrubbingValue = [self scrubbingLabelValueForCanvasXPosition:xPosition plotIndex:plotIndex];
 
     _scrubberThumbView.center = CGPointMake(xPosition + SFGraphChartViewLeftPadding, scrubberYPosition + TopPadding);
-    _scrubberLabel.text = [NSString stringWithFormat:_decimalFormat, scrubbingValue == SFDoubleInvalidValue ? 0.0 : scrubbingValue ];
-    CGSize textSize = [_scrubberLabel.text boundingRectWithSize:CGSizeMake(_plotView.bounds.size.width,
-                                                                           _plotView.bounds.size.height)
-                                                        options:(NSStringDrawingUsesFontLeading | NSStringDrawingUsesLineFragmentOrigin)
-                                                     attributes:@{NSFontAttributeName: _scrubberLabel.font}
-                                                        context:nil].size;
+    if (scrubbingValue != _scrubberLabelValue) {
+        // Formatting and measuring the text is only redone when the value changes
+        _scrubberLabelValue = scrubbingValue;
+        _scrubberLabel.text = [NSString stringWithFormat:_decimalFormat, scrubbingValue == SFDoubleInvalidValue ? 0.0 : scrubbingValue ];
+        _scrubberLabelTextSize = [_scrubberLabel.text boundingRectWithSize:CGSizeMake(_plotView.bounds.size.width,
+                                                                                      _plotView.bounds.size.height)
+                                                                   options:(NSStringDrawingUsesFontLeading | NSStringDrawingUsesLineFragmentOrigin)
+                                                                attributes:@{NSFontAttributeName: _scrubberLabel.font}
+                                                                   context:nil].size;
+    }
+    CGSize textSize = _scrubberLabelTextSize;
     _scrubberLabel.frame = CGRectMake(xPosition + SFGraphChartViewLeftPadding + ScrubberLineToLabelPadding,
                                       CGRectGetMinY(_scrubberLine.frame),
                                       textSize.width + ScrubberLabelHorizontalPadding,
@@ -796,14 +1722,81 @@ SF_INLINE CALayer *graphPointLayerWithColor(UIColor *color, BOOL drawPointIndica
     }
 }
 
-- (NSInteger)pointIndexForXPosition:(CGFloat)xPosition plotIndex:(NSInteger)plotIndex {
-    NSInteger pointIndex = 0;
-    NSInteger numberOfXAxisPoints = self.numberOfXAxisPoints;
-    for (pointIndex = 0; pointIndex < (numberOfXAxisPoints - 1); pointIndex++) {
-        CGFloat xAxisPointValue = xAxisPoint(pointIndex, numberOfXAxisPoints, _plotView.bounds.size.width);
-        if (xAxisPointValue >= xPosition) {
-            break;
+- (const CGFloat *)xAxisPositions {
+    NSInteger numberOfXAxisPoints = MAX(0, self.numberOfXAxisPoints);
+    CGFloat canvasWidth = _plotView.bounds.size.width;
+    NSRange visibleRange = [self visibleXAxisPointRange];
+    if (_xAxisPositions == NULL || numberOfXAxisPoints != _numberOfXAxisPositions || canvasWidth != _xAxisPositionsCanvasWidth
+        || !NSEqualRanges(visibleRange, _xAxisPositionsVisibleRange)) {
+        // Only rebuilt when the plot view width, the number of x-axis points or the visible range change
+        CGFloat *xAxisPositions = realloc(_xAxisPositions, MAX(1, numberOfXAxisPoints) * sizeof(CGFloat));
+        if (xAxisPositions == NULL) {
+            @throw [NSException exceptionWithName:NSMallocException
+                                           reason:@"Unable to allocate the x-axis position table"
+                                         userInfo:nil];
         }
+        for (NSInteger pointIndex = 0; pointIndex < numberOfXAxisPoints; pointIndex++) {
+            xAxisPositions[pointIndex] = xAxisPointInRange(pointIndex, visibleRange, canvasWidth);
+        }
+        _xAxisPositions = xAxisPositions;
+        _numberOfXAxisPositions = numberOfXAxisPoints;
+        _xAxisPositionsCanvasWidth = canvasWidth;
+        _xAxisPositionsVisibleRange = visibleRange;
+    }
+    return _xAxisPositions;
+}
+
+- (const CGFloat *)canvasXPositionsForPlotIndex:(NSInteger)plotIndex {
+    return [self xAxisPositions];
+}
+
+- (NSInteger)numberOfCanvasXPositionsForPlotIndex:(NSInteger)plotIndex {
+    if (plotIndex >= _plotBuffers.count) {
+        return 0;
+    }
+    return MIN((NSInteger)_plotBuffers[plotIndex].count, self.numberOfXAxisPoints);
+}
+
+- (NSInteger)pointIndexForXPosition:(CGFloat)xPosition plotIndex:(NSInteger)plotIndex inclusive:(BOOL)inclusive {
+    // Binary search for the first point at (if inclusive) or after xPosition, as positions never decrease
+    const CGFloat *xPositions = [self canvasXPositionsForPlotIndex:plotIndex];
+    NSInteger lowIndex = 0;
+    NSInteger highIndex = [self numberOfCanvasXPositionsForPlotIndex:plotIndex];
+    while (lowIndex < highIndex) {
+        NSInteger middleIndex = lowIndex + (highIndex - lowIndex) / 2;
+        CGFloat middlePosition = xPositions[middleIndex];
+        if (middlePosition < xPosition || (!inclusive && middlePosition == xPosition)) {
+            lowIndex = middleIndex + 1;
+        } else {
+            highIndex = middleIndex;
+        }
+    }
+    return lowIndex;
+}
+
+- (NSInteger)pointIndexAtOrAfterXPosition:(CGFloat)xPosition plotIndex:(NSInteger)plotIndex {
+    return [self pointIndexForXPosition:xPosition plotIndex:plotIndex inclusive:YES];
+}
+
+- (NSInteger)pointIndexAfterXPosition:(CGFloat)xPosition plotIndex:(NSInteger)plotIndex {
+    return [self pointIndexForXPosition:xPosition plotIndex:plotIndex inclusive:NO];
+}
+
+- (NSInteger)pointIndexForXPosition:(CGFloat)xPosition plotIndex:(NSInteger)plotIndex {
+    NSInteger pointIndex = [self pointIndexAtOrAfterXPosition:xPosition plotIndex:plotIndex];
+    return MIN(pointIndex, MAX(0, [self numberOfCanvasXPositionsForPlotIndex:plotIndex] - 1));
+}
+
+- (NSInteger)pointIndexNearestToXPosition:(CGFloat)xPosition plotIndex:(NSInteger)plotIndex maximumDistance:(CGFloat)maximumDistance {
+    // The closer of the points on each side of xPosition
+    NSInteger numberOfPositions = [self numberOfCanvasXPositionsForPlotIndex:plotIndex];
+    const CGFloat *xPositions = [self canvasXPositionsForPlotIndex:plotIndex];
+    NSInteger pointIndex = [self pointIndexAtOrAfterXPosition:xPosition plotIndex:plotIndex];
+    if (pointIndex > 0 && (pointIndex == numberOfPositions || xPosition - xPositions[pointIndex - 1] < xPositions[pointIndex] - xPosition)) {
+        pointIndex--;
+    }
+    if (pointIndex >= numberOfPositions || fabs(xPositions[pointIndex] - xPosition) > maximumDistance) {
+        return NSNotFound;
     }
     return pointIndex;
 }
@@ -811,46 +1804,38 @@ SF_INLINE CALayer *graphPointLayerWithColor(UIColor *color, BOOL drawPointIndica
 - (NSInteger)numberOfValidValuesForPlotIndex:(NSInteger)plotIndex {
     NSInteger count = 0;
     
-    if (plotIndex < _dataPoints.count) {
-        for (SFValueRange *rangePoint in _dataPoints[plotIndex]) {
-            if (!rangePoint.isUnset) {
-                count++;
-            }
-        }
+    if (plotIndex < _plotBuffers.count) {
+        count = _plotBuffers[plotIndex].numberOfValidValues;
     }
     return count;
 }
 
 - (BOOL)isXPositionSnapped:(CGFloat)xPosition plotIndex:(NSInteger)plotIndex {
-    BOOL snapped = NO;
-    CGFloat viewWidth = _plotView.bounds.size.width;
-    NSInteger numberOfXAxisPoints = self.numberOfXAxisPoints;
-    for (NSInteger idx = 0; idx < numberOfXAxisPoints; idx++) {
-        if (xPosition == xAxisPoint(idx, numberOfXAxisPoints, viewWidth)) {
-            snapped = YES;
-            break;
-        }
-    }
-    return snapped;
+    NSInteger pointIndex = [self pointIndexAtOrAfterXPosition:xPosition plotIndex:plotIndex];
+    return (pointIndex < [self numberOfCanvasXPositionsForPlotIndex:plotIndex]
+            && [self canvasXPositionsForPlotIndex:plotIndex][pointIndex] == xPosition);
 }
 
 - (CGFloat)snappedXPosition:(CGFloat)xPosition plotIndex:(NSInteger)plotIndex {
-    NSInteger numberOfXAxisPoints = self.numberOfXAxisPoints;
-    CGFloat widthBetweenPoints = CGRectGetWidth(self.plotView.frame) / numberOfXAxisPoints;
-    NSUInteger positionCount = self.dataPoints[plotIndex].count;
-    for (NSUInteger pointIndex = 0; pointIndex < positionCount; pointIndex++) {
-        
-        double scrubbingValue = [self scrubbingValueForPlotIndex:plotIndex pointIndex:pointIndex];
-        
-        if (scrubbingValue != SFDoubleInvalidValue) {
-            CGFloat snappedXPosition = xAxisPoint(pointIndex, numberOfXAxisPoints, self.plotView.bounds.size.width);
-            
-            if (fabs(snappedXPosition - xPosition) < (widthBetweenPoints * SnappingClosenessFactor)) {
-                xPosition = snappedXPosition;
-            }
+    CGFloat widthBetweenPoints = CGRectGetWidth(self.plotView.frame) / MAX(1, [self visibleXAxisPointRange].length);
+    CGFloat snappingDistance = widthBetweenPoints * SnappingClosenessFactor;
+    
+    // Only the points within the snapping distance are considered, snapping to the closest valid one
+    CGFloat snappedXPosition = xPosition;
+    CGFloat closestDistance = snappingDistance;
+    NSInteger positionCount = [self numberOfCanvasXPositionsForPlotIndex:plotIndex];
+    const CGFloat *xPositions = [self canvasXPositionsForPlotIndex:plotIndex];
+    for (NSInteger pointIndex = [self pointIndexAfterXPosition:xPosition - snappingDistance plotIndex:plotIndex];
+         pointIndex < positionCount && xPositions[pointIndex] < xPosition + snappingDistance;
+         pointIndex++) {
+        CGFloat distance = fabs(xPositions[pointIndex] - xPosition);
+        if (distance < closestDistance &&
+            [self scrubbingValueForPlotIndex:plotIndex pointIndex:pointIndex] != SFDoubleInvalidValue) {
+            snappedXPosition = xPositions[pointIndex];
+            closestDistance = distance;
         }
     }
-    return xPosition;
+    return snappedXPosition;
 }
 
 - (double)scrubbingLabelValueForCanvasXPosition:(CGFloat)xPosition plotIndex:(NSInteger)plotIndex {
@@ -958,12 +1943,27 @@ SF_INLINE CALayer *graphPointLayerWithColor(UIColor *color, BOOL drawPointIndica
     return nil;
 }
 
-- (NSObject<SFValueCollectionType> *)dummyPoint {
+- (void)appendDataPointForPointIndex:(NSInteger)pointIndex plotIndex:(NSInteger)plotIndex toPlotBuffer:(SFGraphChartPlotBuffer *)plotBuffer {
     [self throwOverrideException];
-    return nil;
 }
 
-- (NSMutableArray<NSObject<SFValueCollectionType> *> *)normalizedCanvasDataPointsForPlotIndex:(NSInteger)plotIndex canvasHeight:(CGFloat)viewHeight {
+- (void)appendDataPointsInRange:(NSRange)range plotIndex:(NSInteger)plotIndex toPlotBuffer:(SFGraphChartPlotBuffer *)plotBuffer {
+    for (NSInteger pointIndex = range.location; pointIndex < NSMaxRange(range); pointIndex++) {
+        [self appendDataPointForPointIndex:pointIndex plotIndex:plotIndex toPlotBuffer:plotBuffer];
+    }
+}
+
+- (void)replaceDataPointForPointIndex:(NSInteger)pointIndex plotIndex:(NSInteger)plotIndex inPlotBuffer:(SFGraphChartPlotBuffer *)plotBuffer {
+    [self throwOverrideException];
+}
+
+- (void)replaceDataPointsAtIndexes:(NSIndexSet *)indexes plotIndex:(NSInteger)plotIndex inPlotBuffer:(SFGraphChartPlotBuffer *)plotBuffer {
+    [indexes enumerateIndexesUsingBlock:^(NSUInteger pointIndex, BOOL *stop) {
+        [self replaceDataPointForPointIndex:pointIndex plotIndex:plotIndex inPlotBuffer:plotBuffer];
+    }];
+}
+
+- (NSObject<SFValueCollectionType> *)storedDataPointForPointIndex:(NSInteger)pointIndex plotIndex:(NSInteger)plotIndex {
     [self throwOverrideException];
     return nil;
 }
@@ -972,6 +1972,11 @@ SF_INLINE CALayer *graphPointLayerWithColor(UIColor *color, BOOL drawPointIndica
     [self throwOverrideException];
 }
 
+- (nullable SFGraphChartTileDrawingBlock)tileDrawingBlockForPlotIndex:(NSInteger)plotIndex geometry:(SFGraphChartTileGeometry)geometry {
+    [self throwOverrideException];
+    return nil;
+}
+
 - (void)layoutLineLayersForPlotIndex:(NSInteger)plotIndex {
     [self throwOverrideException];
 }
@@ -981,9 +1986,6 @@ SF_INLINE CALayer *graphPointLayerWithColor(UIColor *color, BOOL drawPointIndica
     return NO;
 }
 
-- (void)calculateMinAndMaxValues {
-    [self throwOverrideException];
-}
 
 - (double)scrubbingValueForPlotIndex:(NSInteger)plotIndex pointIndex:(NSInteger)pointIndex {
     [self throwOverrideException];
@@ -1009,46 +2011,94 @@ SF_INLINE CALayer *graphPointLayerWithColor(UIColor *color, BOOL drawPointIndica
     return NO;
 }
 
+// Elements are created as VoiceOver reaches them, so charts of any size cost the same to reload
+- (NSInteger)accessibilityElementCount {
+    NSInteger maxNumberOfPoints = 0;
+    for (SFGraphChartPlotBuffer *plotBuffer in _plotBuffers) {
+        maxNumberOfPoints = MAX(maxNumberOfPoints, plotBuffer.count);
+    }
+    return maxNumberOfPoints;
+}
+
+- (id)accessibilityElementAtIndex:(NSInteger)index {
+    NSInteger maxNumberOfPoints = [self accessibilityElementCount];
+    if (index < 0 || index >= maxNumberOfPoints) {
+        return nil;
+    }
+    if (!_axElementCache) {
+        _axElementCache = [[SFLeastRecentlyUsedCache alloc] initWithCapacity:AccessibilityElementCacheCapacity];
+    }
+    SFLineGraphAccessibilityElement *element = [_axElementCache objectForKey:@(index)];
+    if (!element) {
+        element = [self _axAccessibilityElementForPointIndex:index maxIndex:maxNumberOfPoints];
+        [_axElementCache setObject:element forKey:@(index)];
+    }
+    return element;
+}
+
+- (NSInteger)indexOfAccessibilityElement:(id)element {
+    // Evicted elements still focused by VoiceOver keep their index
+    if (![element isKindOfClass:[SFLineGraphAccessibilityElement class]]
+        || [(SFLineGraphAccessibilityElement *)element accessibilityContainer] != self) {
+        return NSNotFound;
+    }
+    NSInteger index = [(SFLineGraphAccessibilityElement *)element index];
+    return (index < [self accessibilityElementCount]) ? index : NSNotFound;
+}
+
 #pragma mark - Accessibility Helpers
 
 - (void)_axVoiceOverStatusChanged:(NSNotification *)notification {
-    [self _axCreateAccessibilityElementsIfNeeded];
+    [self _axInvalidateAccessibilityElements];
 }
 
-- (void)_axCreateAccessibilityElementsIfNeeded {
-    if (!UIAccessibilityIsVoiceOverRunning()) {
-        // No need to creating accessibility elements if Voice Over is not running
-        return;
+- (void)_axInvalidateAccessibilityElements {
+    // Evicted elements still focused by VoiceOver format their strings again too
+    _axStringGeneration++;
+    [_axElementCache removeAllObjects];
+    if (UIAccessibilityIsVoiceOverRunning()) {
+        UIAccessibilityPostNotification(UIAccessibilityLayoutChangedNotification, nil);
     }
+}
+
+- (void)_axInvalidateAccessibilityStrings {
+    _axStringGeneration++;
+}
+
+- (NSUInteger)accessibilityStringGenerationForLineGraphAccessibilityElement:(SFLineGraphAccessibilityElement *)element {
+    return _axStringGeneration;
+}
+
+- (SFLineGraphAccessibilityElement *)_axAccessibilityElementForPointIndex:(NSInteger)pointIndex maxIndex:(NSInteger)maxIndex {
+    // The label and value are formatted once VoiceOver reads them
+    SFLineGraphAccessibilityElement *element = [[SFLineGraphAccessibilityElement alloc] initWithAccessibilityContainer:self index:pointIndex maxIndex:maxIndex];
+    element.dataSource = self;
+    return element;
+}
+
+- (NSString *)accessibilityLabelForLineGraphAccessibilityElement:(SFLineGraphAccessibilityElement *)element {
+    NSInteger pointIndex = element.index;
+    if ([_dataSource respondsToSelector:@selector(graphChartView:titleForXAxisAtPointIndex:)]) {
+        return [self.dataSource graphChartView:self titleForXAxisAtPointIndex:pointIndex];
+    }
+    return [NSString stringWithFormat:SFLocalizedString(@"AX_GRAPH_POINT_%@", nil), SFLocalizedStringFromNumber(@(pointIndex))];
+}
+
+- (NSString *)accessibilityValueForLineGraphAccessibilityElement:(SFLineGraphAccessibilityElement *)element {
+    NSInteger pointIndex = element.index;
     
-    NSInteger maxNumberOfPoints = [[_dataPoints valueForKeyPath:@"@max.@count.self"] integerValue];
-    NSMutableArray<id> *accessibilityElements = [[NSMutableArray alloc] initWithCapacity:maxNumberOfPoints];
-    
-    for (NSInteger pointIndex = 0; pointIndex < maxNumberOfPoints; pointIndex++) {
-        SFLineGraphAccessibilityElement *element = [[SFLineGraphAccessibilityElement alloc] initWithAccessibilityContainer:self index:pointIndex maxIndex:maxNumberOfPoints];
+    // Data points for all plots at any given pointIndex must be included (eg "2 and 4" or "range from 1-2 and range from 4-5").
+    NSString *value = nil;
+    for (NSInteger plotIndex = 0; plotIndex < _plotBuffers.count; plotIndex++) {
         
-        // Data points for all plots at any given pointIndex must be included (eg "2 and 4" or "range from 1-2 and range from 4-5").
-        NSString *value = nil;
-        for (NSInteger plotIndex = 0; plotIndex < _dataPoints.count; plotIndex++) {
-            
-            // Boundary check
-            if ( pointIndex < _dataPoints[plotIndex].count ) {
-                NSString *and = (value == nil || value.length == 0 ? nil : SFLocalizedString(@"AX_GRAPH_AND_SEPARATOR", nil));
-                NSObject<SFValueCollectionType> *dataPoint = _dataPoints[plotIndex][pointIndex];
-                value = SFAccessibilityStringForVariables(value, and, dataPoint.accessibilityLabel);
-            }
+        // Boundary check
+        if ( pointIndex < _plotBuffers[plotIndex].count ) {
+            NSString *and = (value == nil || value.length == 0 ? nil : SFLocalizedString(@"AX_GRAPH_AND_SEPARATOR", nil));
+            NSObject<SFValueCollectionType> *dataPoint = [self storedDataPointForPointIndex:pointIndex plotIndex:plotIndex];
+            value = SFAccessibilityStringForVariables(value, and, dataPoint.accessibilityLabel);
         }
-        
-        if ([_dataSource respondsToSelector:@selector(graphChartView:titleForXAxisAtPointIndex:)]) {
-            element.accessibilityLabel = [self.dataSource graphChartView:self titleForXAxisAtPointIndex:pointIndex];
-        } else {
-            element.accessibilityLabel = [NSString stringWithFormat:SFLocalizedString(@"AX_GRAPH_POINT_%@", nil), SFLocalizedStringFromNumber(@(pointIndex))];
-        }
-        element.accessibilityValue = value;
-        [accessibilityElements addObject:element];
     }
-    
-    self.accessibilityElements = accessibilityElements;
+    return value;
 }
 
 @end
@@ -1056,132 +2106,158 @@ SF_INLINE CALayer *graphPointLayerWithColor(UIColor *color, BOOL drawPointIndica
 
 @implementation SFValueRangeGraphChartView {
     NSMutableArray<NSMutableArray<CALayer *> *> *_pointLayers;
+    NSMutableDictionary<NSNumber *, CAShapeLayer *> *_pointPathLayers; // Compound point indicator paths of the plots above the sequential animation threshold
+    NSMutableDictionary<NSNumber *, NSData *> *_pointLayerOffsets; // Index of the first point layer of each point, followed by the number of point layers
+    NSMutableDictionary<NSNumber *, NSValue *> *_visiblePointLayerRanges; // Point layers positioned by the last layout pass
             }
 
 @dynamic dataSource;
-@dynamic dataPoints;
-@dynamic yAxisPoints;
     
 - (void)sharedInit {
     [super sharedInit];
     _pointLayers = [NSMutableArray new];
+    _pointPathLayers = [NSMutableDictionary new];
+    _pointLayerOffsets = [NSMutableDictionary new];
+    _visiblePointLayerRanges = [NSMutableDictionary new];
             }
 
-- (void)reloadData {
-    [super reloadData];
+- (void)updateLayersForReloadedData {
+    [super updateLayersForReloadedData];
     [self updatePointLayers];
-    [self setNeedsLayout];
         }
 
 - (SFValueRange *)dataPointForPointIndex:(NSInteger)pointIndex plotIndex:(NSInteger)plotIndex {
     return [self.dataSource graphChartView:self dataPointForPointIndex:pointIndex plotIndex:plotIndex];
     }
 
-- (SFValueRange *)dummyPoint {
-    return [SFValueRange new];
+- (void)appendDataPointForPointIndex:(NSInteger)pointIndex plotIndex:(NSInteger)plotIndex toPlotBuffer:(SFGraphChartPlotBuffer *)plotBuffer {
+    SFValueRange *dataPoint = [self dataPointForPointIndex:pointIndex plotIndex:plotIndex];
+    [plotBuffer appendMinimumValue:dataPoint.minimumValue maximumValue:dataPoint.maximumValue];
 }
 
-- (NSMutableArray<SFValueRange *> *)normalizedCanvasDataPointsForPlotIndex:(NSInteger)plotIndex canvasHeight:(CGFloat)viewHeight {
-    NSMutableArray<SFValueRange *> *normalizedPoints = [NSMutableArray new];
-    
-    if (plotIndex < self.dataPoints.count) {
-        NSUInteger pointCount = self.dataPoints[plotIndex].count;
-        for (NSUInteger pointIndex = 0; pointIndex < pointCount; pointIndex++) {
-            
-            SFValueRange *normalizedRangePoint = [SFValueRange new];
-            SFValueRange *dataPointValue = self.dataPoints[plotIndex][pointIndex];
-            
-            if (dataPointValue.isUnset) {
-                normalizedRangePoint.minimumValue = normalizedRangePoint.maximumValue = viewHeight;
-            } else if (self.minimumValue == self.maximumValue) {
-                normalizedRangePoint.minimumValue = normalizedRangePoint.maximumValue = viewHeight / 2;
-            } else {
-                double range = self.maximumValue - self.minimumValue;
-                double normalizedMinimumValue = (dataPointValue.minimumValue - self.minimumValue) / range * viewHeight;
-                double normalizedMaximumValue = (dataPointValue.maximumValue - self.minimumValue) / range * viewHeight;
-                
-                normalizedRangePoint.minimumValue = viewHeight - normalizedMinimumValue;
-                normalizedRangePoint.maximumValue = viewHeight - normalizedMaximumValue;
-            }
-            [normalizedPoints addObject:normalizedRangePoint];
-        }
+- (void)appendDataPointsInRange:(NSRange)range plotIndex:(NSInteger)plotIndex toPlotBuffer:(SFGraphChartPlotBuffer *)plotBuffer {
+    if (![self.dataSource respondsToSelector:@selector(graphChartView:getMinimumValues:maximumValues:range:plotIndex:)]) {
+        [super appendDataPointsInRange:range plotIndex:plotIndex toPlotBuffer:plotBuffer];
+        return;
     }
     
-    return normalizedPoints;
+    // Let the data source fill the plot buffer directly
+    [plotBuffer appendValuesWithCount:range.length fillBlock:^(double *minimumValues, double *maximumValues) {
+        [self.dataSource graphChartView:self
+                       getMinimumValues:minimumValues
+                          maximumValues:maximumValues
+                                  range:range
+                              plotIndex:plotIndex];
+    }];
 }
 
-- (void)calculateMinAndMaxValues {
-    self.minimumValue = SFDoubleInvalidValue;
-    self.maximumValue = SFDoubleInvalidValue;
-    
-    BOOL minimumValueProvided = NO;
-    BOOL maximumValueProvided = NO;
-    
-    if ([self.dataSource respondsToSelector:@selector(minimumValueForGraphChartView:)]) {
-        self.minimumValue = [self.dataSource minimumValueForGraphChartView:self];
-        minimumValueProvided = YES;
+- (void)replaceDataPointForPointIndex:(NSInteger)pointIndex plotIndex:(NSInteger)plotIndex inPlotBuffer:(SFGraphChartPlotBuffer *)plotBuffer {
+    SFValueRange *dataPoint = [self dataPointForPointIndex:pointIndex plotIndex:plotIndex];
+    [plotBuffer setMinimumValue:dataPoint.minimumValue maximumValue:dataPoint.maximumValue atIndex:pointIndex];
+}
+
+- (void)replaceDataPointsAtIndexes:(NSIndexSet *)indexes plotIndex:(NSInteger)plotIndex inPlotBuffer:(SFGraphChartPlotBuffer *)plotBuffer {
+    if (![self.dataSource respondsToSelector:@selector(graphChartView:getMinimumValues:maximumValues:range:plotIndex:)]) {
+        [super replaceDataPointsAtIndexes:indexes plotIndex:plotIndex inPlotBuffer:plotBuffer];
+        return;
     }
     
-    if ([self.dataSource respondsToSelector:@selector(maximumValueForGraphChartView:)]) {
-        self.maximumValue = [self.dataSource maximumValueForGraphChartView:self];
-        maximumValueProvided = YES;
+    // Let the data source fill each contiguous range of the plot buffer directly
+    [indexes enumerateRangesUsingBlock:^(NSRange range, BOOL *stop) {
+        [plotBuffer replaceValuesInRange:range fillBlock:^(double *minimumValues, double *maximumValues) {
+            [self.dataSource graphChartView:self
+                           getMinimumValues:minimumValues
+                              maximumValues:maximumValues
+                                      range:range
+                                  plotIndex:plotIndex];
+        }];
+    }];
+}
+
+- (SFValueRange *)storedDataPointForPointIndex:(NSInteger)pointIndex plotIndex:(NSInteger)plotIndex {
+    SFGraphChartPlotBuffer *plotBuffer = self.plotBuffers[plotIndex];
+    return [[SFValueRange alloc] initWithMinimumValue:plotBuffer.minimumValues[pointIndex] maximumValue:plotBuffer.maximumValues[pointIndex]];
+}
+
+#pragma mark - Layout & Drawing
+
+- (void)setMaximumNumberOfSequentiallyAnimatedPoints:(NSInteger)maximumNumberOfSequentiallyAnimatedPoints {
+    if (maximumNumberOfSequentiallyAnimatedPoints < 0) {
+        @throw [NSException exceptionWithName:NSInvalidArgumentException
+                                       reason:@"maximumNumberOfSequentiallyAnimatedPoints cannot be lower than 0"
+                                     userInfo:nil];
     }
-    
-    if (!minimumValueProvided || !maximumValueProvided) {
-        NSInteger numberOfPlots = [self numberOfPlots];
-        for (NSInteger plotIndex = 0; plotIndex < numberOfPlots; plotIndex++) {
-            NSInteger numberOfPlotPoints = self.dataPoints[plotIndex].count;
-            for (NSInteger pointIndex = 0; pointIndex < numberOfPlotPoints; pointIndex++) {
-                SFValueRange *point = self.dataPoints[plotIndex][pointIndex];
-                if (!minimumValueProvided &&
-                    point.minimumValue != SFDoubleInvalidValue &&
-                    ((self.minimumValue == SFDoubleInvalidValue) || (point.minimumValue < self.minimumValue))) {
-                    self.minimumValue = point.minimumValue;
-                }
-                if (!maximumValueProvided &&
-                    point.maximumValue != SFDoubleInvalidValue &&
-                    ((self.maximumValue == SFDoubleInvalidValue) || (point.maximumValue > self.maximumValue))) {
-                    self.maximumValue = point.maximumValue;
-                }
-            }
+    _maximumNumberOfSequentiallyAnimatedPoints = maximumNumberOfSequentiallyAnimatedPoints;
+    [self updatePointLayers];
+    [self invalidateLayout:SFGraphChartViewInvalidationData];
+}
+
+- (NSInteger)numberOfPointIndicatorPositionsForPlotIndex:(NSInteger)plotIndex {
+    SFGraphChartPlotBuffer *plotBuffer = self.plotBuffers[plotIndex];
+    NSInteger numberOfPositions = 0;
+    NSUInteger pointCount = plotBuffer.count;
+    for (NSUInteger pointIndex = 0; pointIndex < pointCount; pointIndex++) {
+        if (![plotBuffer isUnsetAtIndex:pointIndex]) {
+            numberOfPositions += (plotBuffer.minimumValues[pointIndex] != plotBuffer.maximumValues[pointIndex]) ? 2 : 1;
         }
     }
-    
-    if (self.minimumValue == SFDoubleInvalidValue) {
-        self.minimumValue = 0;
-    }
-    if (self.maximumValue == SFDoubleInvalidValue) {
-        self.maximumValue = 0;
-    }
+    return numberOfPositions;
 }
 
-#pragma mark - Layout & Drawing
+- (void)removePointLayersForPlotIndex:(NSInteger)plotIndex {
+    [_pointLayers[plotIndex] makeObjectsPerformSelector:@selector(removeFromSuperlayer)];
+    [_pointLayers[plotIndex] removeAllObjects];
+    [_pointPathLayers[@(plotIndex)] removeFromSuperlayer];
+    [_pointPathLayers removeObjectForKey:@(plotIndex)];
+    [_pointLayerOffsets removeObjectForKey:@(plotIndex)];
+    [_visiblePointLayerRanges removeObjectForKey:@(plotIndex)];
+}
 
 - (void)updatePointLayersForPlotIndex:(NSInteger)plotIndex {
-    if (plotIndex < self.dataPoints.count) {
+    if (self.usesTiledRendering) {
+        // Tiled plots draw their point indicators into the tiles, if at all
+        return;
+    }
+    if (plotIndex < self.plotBuffers.count) {
         UIColor *color = [self colorForPlotIndex:plotIndex];
-        NSUInteger pointCount = self.dataPoints[plotIndex].count;
+        if ([self numberOfPointIndicatorPositionsForPlotIndex:plotIndex] > _maximumNumberOfSequentiallyAnimatedPoints) {
+            // A single compound path draws every point indicator of the plot
+            CAShapeLayer *pointPathLayer = graphPointPathLayerWithColor(color);
+            [self.plotView.layer addSublayer:pointPathLayer];
+            _pointPathLayers[@(plotIndex)] = pointPathLayer;
+            return;
+        }
+        
+        SFGraphChartPlotBuffer *plotBuffer = self.plotBuffers[plotIndex];
+        NSUInteger pointCount = plotBuffer.count;
+        NSMutableData *pointLayerOffsetData = [NSMutableData dataWithLength:(pointCount + 1) * sizeof(NSInteger)];
+        NSInteger *pointLayerOffsets = pointLayerOffsetData.mutableBytes;
         for (NSUInteger pointIndex = 0; pointIndex < pointCount; pointIndex++) {
-            SFValueRange *dataPoint = self.dataPoints[plotIndex][pointIndex];
-            if (!dataPoint.isUnset) {
+            pointLayerOffsets[pointIndex] = _pointLayers[plotIndex].count;
+            if (![plotBuffer isUnsetAtIndex:pointIndex]) {
                 BOOL drawPointIndicator = [self shouldDrawPointIndicatorForPointWithIndex:pointIndex inPlotWithIndex:plotIndex];
                 CALayer *pointLayer = graphPointLayerWithColor(color, drawPointIndicator);
                 [self.plotView.layer addSublayer:pointLayer];
                 [_pointLayers[plotIndex] addObject:pointLayer];
                 
-                if (!dataPoint.isEmptyRange) {
+                if (plotBuffer.minimumValues[pointIndex] != plotBuffer.maximumValues[pointIndex]) {
                     CALayer *pointLayer = graphPointLayerWithColor(color, drawPointIndicator);
                     [self.plotView.layer addSublayer:pointLayer];
                     [_pointLayers[plotIndex] addObject:pointLayer];
                 }
                 }
             }
+        pointLayerOffsets[pointCount] = _pointLayers[plotIndex].count;
+        _pointLayerOffsets[@(plotIndex)] = pointLayerOffsetData;
+        // New layers are visible until the first layout pass positions or hides them
+        _visiblePointLayerRanges[@(plotIndex)] = [NSValue valueWithRange:NSMakeRange(0, _pointLayers[plotIndex].count)];
                 }
             }
     
 - (void)updatePlotColorsForPlotIndex:(NSInteger)plotIndex {
     [super updatePlotColorsForPlotIndex:plotIndex];
     UIColor *color = [self colorForPlotIndex:plotIndex];
+    _pointPathLayers[@(plotIndex)].strokeColor = color.CGColor;
     for (NSUInteger pointIndex = 0; pointIndex < _pointLayers[plotIndex].count; pointIndex++) {
         CALayer *pointLayer = _pointLayers[plotIndex][pointIndex];
         if (pointLayer.contents) {
@@ -1190,9 +2266,20 @@ SF_INLINE CALayer *graphPointLayerWithColor(UIColor *color, BOOL drawPointIndica
         }
     }
     
+- (void)updatePlotLayersForPlotIndex:(NSInteger)plotIndex {
+    [super updatePlotLayersForPlotIndex:plotIndex];
+    [self removePointLayersForPlotIndex:plotIndex];
+    [self updatePointLayersForPlotIndex:plotIndex];
+}
+
+- (void)layoutPlotLayersForPlotIndex:(NSInteger)plotIndex {
+    [super layoutPlotLayersForPlotIndex:plotIndex];
+    [self layoutPointLayersForPlotIndex:plotIndex];
+}
+
 - (void)updatePointLayers {
     for (NSInteger plotIndex = 0; plotIndex < _pointLayers.count; plotIndex++) {
-        [_pointLayers[plotIndex] makeObjectsPerformSelector:@selector(removeFromSuperlayer)];
+        [self removePointLayersForPlotIndex:plotIndex];
     }
     [_pointLayers removeAllObjects];
     
@@ -1204,55 +2291,106 @@ SF_INLINE CALayer *graphPointLayerWithColor(UIColor *color, BOOL drawPointIndica
     }
     }
 
-- (void)layoutSubviews {
-    [super layoutSubviews];
+- (void)updatePlotLayers {
+    [super updatePlotLayers];
+    [self updatePointLayers];
+}
+
+- (void)layoutPlotLayers {
+    [super layoutPlotLayers];
     [self layoutPointLayers];
 }
 
 - (void)layoutPointLayers {
-    NSInteger numberOfPlots = [self numberOfPlots];
-
-    if (self.yAxisPoints.count != numberOfPlots) {
+    if (![self hasCanvasValues]) {
         // avoid layout if points have not been normalized yet
         return;
-        }
+    }
     
+    NSInteger numberOfPlots = [self numberOfPlots];
     for (NSInteger plotIndex = 0; plotIndex < numberOfPlots; plotIndex++) {
         [self layoutPointLayersForPlotIndex:plotIndex];
     }
 }
 
 - (void)layoutPointLayersForPlotIndex:(NSInteger)plotIndex {
-    if (plotIndex < self.dataPoints.count) {
-        NSUInteger pointLayerIndex = 0;
-        for (NSUInteger pointIndex = 0; pointIndex < self.dataPoints[plotIndex].count; pointIndex++) {
-            SFValueRange *dataPointValue = self.dataPoints[plotIndex][pointIndex];
-            if (!dataPointValue.isUnset) {
-                CGFloat positionOnXAxis = xAxisPoint(pointIndex, self.numberOfXAxisPoints, self.plotView.bounds.size.width);
-                positionOnXAxis += [self xOffsetForPlotIndex:plotIndex];
-                SFValueRange *yAxisValueRange = self.yAxisPoints[plotIndex][pointIndex];
-                CALayer *pointLayer = _pointLayers[plotIndex][pointLayerIndex];
-                pointLayer.position = CGPointMake(positionOnXAxis, yAxisValueRange.minimumValue);
+    if (!self.usesTiledRendering && plotIndex < self.plotBuffers.count) {
+        SFGraphChartPlotBuffer *plotBuffer = self.plotBuffers[plotIndex];
+        NSRange culledRange = [self culledXAxisPointRangeForPlotIndex:plotIndex];
+        const CGFloat *xPositions = [self canvasXPositionsForPlotIndex:plotIndex];
+        CGFloat xOffset = [self xOffsetForPlotIndex:plotIndex];
+        CAShapeLayer *pointPathLayer = _pointPathLayers[@(plotIndex)];
+        if (pointPathLayer) {
+            [self layoutPointPathLayer:pointPathLayer forPlotIndex:plotIndex xOffset:xOffset];
+            return;
+        }
+        
+        const NSInteger *pointLayerOffsets = _pointLayerOffsets[@(plotIndex)].bytes;
+        if (!pointLayerOffsets) {
+            return;
+        }
+        
+        // Only the point layers of the culled range are positioned; the ones positioned by the previous
+        // layout pass which left the range are hidden
+        NSArray<CALayer *> *pointLayers = _pointLayers[plotIndex];
+        culledRange = NSIntersectionRange(culledRange, NSMakeRange(0, plotBuffer.count));
+        NSInteger firstPointLayerIndex = pointLayerOffsets[culledRange.location];
+        NSRange pointLayerRange = NSMakeRange(firstPointLayerIndex, pointLayerOffsets[NSMaxRange(culledRange)] - firstPointLayerIndex);
+        NSRange previousPointLayerRange = _visiblePointLayerRanges[@(plotIndex)].rangeValue;
+        for (NSUInteger pointLayerIndex = previousPointLayerRange.location; pointLayerIndex < NSMaxRange(previousPointLayerRange); pointLayerIndex++) {
+            if (!NSLocationInRange(pointLayerIndex, pointLayerRange)) {
+                pointLayers[pointLayerIndex].hidden = YES;
+            }
+        }
+        
+        NSUInteger pointLayerIndex = pointLayerRange.location;
+        for (NSUInteger pointIndex = culledRange.location; pointIndex < NSMaxRange(culledRange); pointIndex++) {
+            if (![plotBuffer isUnsetAtIndex:pointIndex]) {
+                CGFloat positionOnXAxis = xPositions[pointIndex] + xOffset;
+                CALayer *pointLayer = pointLayers[pointLayerIndex];
+                pointLayer.hidden = NO;
+                pointLayer.position = CGPointMake(positionOnXAxis, plotBuffer.canvasMinimumValues[pointIndex]);
                 pointLayerIndex++;
 
-                if (!yAxisValueRange.isEmptyRange) {
-                    CALayer *pointLayer = _pointLayers[plotIndex][pointLayerIndex];
-                    pointLayer.position = CGPointMake(positionOnXAxis, yAxisValueRange.maximumValue);
+                if (plotBuffer.minimumValues[pointIndex] != plotBuffer.maximumValues[pointIndex]) {
+                    CALayer *pointLayer = pointLayers[pointLayerIndex];
+                    pointLayer.hidden = NO;
+                    pointLayer.position = CGPointMake(positionOnXAxis, plotBuffer.canvasMaximumValues[pointIndex]);
                     pointLayerIndex++;
                 }
             }
         }
+        _visiblePointLayerRanges[@(plotIndex)] = [NSValue valueWithRange:pointLayerRange];
     }
 }
 
+- (void)layoutPointPathLayer:(CAShapeLayer *)pointPathLayer forPlotIndex:(NSInteger)plotIndex xOffset:(CGFloat)xOffset {
+    SFGraphChartPlotBuffer *plotBuffer = self.plotBuffers[plotIndex];
+    NSRange culledRange = [self culledXAxisPointRangeForPlotIndex:plotIndex];
+    const CGFloat *xPositions = [self canvasXPositionsForPlotIndex:plotIndex];
+    CGMutablePathRef pointPath = CGPathCreateMutable();
+    for (NSUInteger pointIndex = culledRange.location; pointIndex < NSMaxRange(culledRange); pointIndex++) {
+        if (![self shouldDrawPointIndicatorForPointWithIndex:pointIndex inPlotWithIndex:plotIndex]) {
+            continue;
+        }
+        CGFloat positionOnXAxis = xPositions[pointIndex] + xOffset;
+        addPointIndicatorToPath(pointPath, CGPointMake(positionOnXAxis, plotBuffer.canvasMinimumValues[pointIndex]));
+        if (plotBuffer.minimumValues[pointIndex] != plotBuffer.maximumValues[pointIndex]) {
+            addPointIndicatorToPath(pointPath, CGPointMake(positionOnXAxis, plotBuffer.canvasMaximumValues[pointIndex]));
+        }
+    }
+    pointPathLayer.path = pointPath;
+    CGPathRelease(pointPath);
+}
+
 #pragma mark - Scrubbing
 
 - (double)scrubbingValueForPlotIndex:(NSInteger)plotIndex pointIndex:(NSInteger)pointIndex {
-    return self.dataPoints[plotIndex][pointIndex].maximumValue;
+    return self.plotBuffers[plotIndex].maximumValues[pointIndex];
 }
 
 - (double)scrubbingYAxisPointForPlotIndex:(NSInteger)plotIndex pointIndex:(NSInteger)pointIndex {
-    return self.yAxisPoints[plotIndex][pointIndex].maximumValue;
+    return self.plotBuffers[plotIndex].canvasMaximumValues[pointIndex];
 }
 
 #pragma mark - Animation
@@ -1263,6 +2401,8 @@ SF_INLINE CALayer *graphPointLayerWithColor(UIColor *color, BOOL drawPointIndica
     for (CAShapeLayer *pointLayer in _pointLayers[plotIndex]) {
         pointLayer.opacity = 0;
     }
+    [_pointPathLayers[@(plotIndex)] removeAllAnimations];
+    _pointPathLayers[@(plotIndex)].opacity = 0;
 }
 
 - (void)animateLayersSequentiallyWithDuration:(NSTimeInterval)duration plotIndex:(NSInteger)plotIndex {
@@ -1277,6 +2417,11 @@ SF_INLINE CALayer *graphPointLayerWithColor(UIColor *color, BOOL drawPointIndica
             pointDelay += pointFadeDuration;
         }
     }
+    CAShapeLayer *pointPathLayer = _pointPathLayers[@(plotIndex)];
+    if (pointPathLayer) {
+        // Point indicators drawn as a compound path fade in all at once
+        [self animateLayer:pointPathLayer keyPath:@"opacity" duration:duration startDelay:0];
+    }
 }
 
 @end
@@ -31,7 +31,13 @@
 
 
 #import "SFGraphChartView.h"
+#import "SFLineGraphChartView.h"
 #import "SFChartTypes.h"
+#import "SFGraphChartKernels.h"
+#import "SFChartGeometry.h"
+#import "SFChartInstrumentation.h"
+#import "SFGraphChartPlotBuffer.h"
+#import "SFGraphChartTileRenderer.h"
 #import "SFHelpers_Private.h"
 
 
@@ -62,39 +68,67 @@ typedef NS_ENUM(NSUInteger, SFGraphAnimationType) {
     SFGraphAnimationTypePop
 };
 
+/**
+ The stages of a graph chart view layout pass which need to be redone. Layout passes without any
+ invalidated stage only position the subviews.
+ */
+typedef NS_OPTIONS(NSUInteger, SFGraphChartViewInvalidation) {
+    SFGraphChartViewInvalidationData = 1 << 0,              // Normalizes the stale canvas values and lays out the plots
+    SFGraphChartViewInvalidationPlotGeometry = 1 << 1,      // Lays out the plots for the plot view size
+    SFGraphChartViewInvalidationReferenceLines = 1 << 2,    // Lays out the horizontal and vertical reference lines
+    SFGraphChartViewInvalidationAppearance = 1 << 3,        // Updates the plot colors
+    SFGraphChartViewInvalidationAll = (SFGraphChartViewInvalidationData |
+                                       SFGraphChartViewInvalidationPlotGeometry |
+                                       SFGraphChartViewInvalidationReferenceLines |
+                                       SFGraphChartViewInvalidationAppearance)
+};
+
 extern const CGFloat SFGraphChartViewLeftPadding;
 extern const CGFloat SFGraphChartViewPointAndLineWidth;
 extern const CGFloat SFGraphChartViewScrubberMoveAnimationDuration;
 extern const CGFloat SFGraphChartViewAxisTickLength;
 extern const CGFloat SFGraphChartViewYAxisTickPadding;
+extern const CGFloat SFGraphChartViewPointIndicatorLineWidth;
+extern const CGFloat SFGraphChartViewSelectionHitSlop; // Distance a tap may land outside of a point and still select it
 
 SF_INLINE CGFloat scalePixelAdjustment() {
     return (1.0 / [UIScreen mainScreen].scale);
 }
 
-SF_INLINE CAShapeLayer *graphLineLayer() {
-    CAShapeLayer *lineLayer = [CAShapeLayer layer];
+SF_INLINE void setUpGraphLineLayer(CAShapeLayer *lineLayer) {
     lineLayer.fillColor = [UIColor clearColor].CGColor;
     lineLayer.lineJoin = kCALineJoinRound;
     lineLayer.lineCap = kCALineCapRound;
     lineLayer.opacity = 1.0;
+}
+
+SF_INLINE CAShapeLayer *graphLineLayer() {
+    CAShapeLayer *lineLayer = [CAShapeLayer layer];
+    SFChartNoteAllocatedLayer();
+    setUpGraphLineLayer(lineLayer);
     return lineLayer;
 }
 
 SF_INLINE CGFloat xAxisPoint(NSInteger pointIndex, NSInteger numberOfXAxisPoints, CGFloat canvasWidth) {
-    return floor((canvasWidth / MAX(1, numberOfXAxisPoints - 1)) * pointIndex);
+    return SFChartGeometryXAxisPoint(pointIndex, numberOfXAxisPoints, canvasWidth);
+}
+
+// Points outside of the visible range are positioned past the edges of the canvas
+SF_INLINE CGFloat xAxisPointInRange(NSInteger pointIndex, NSRange visibleRange, CGFloat canvasWidth) {
+    return xAxisPoint(pointIndex - (NSInteger)visibleRange.location, visibleRange.length, canvasWidth);
+}
+
+SF_INLINE double normalizedCanvasValue(double value, double minimumValue, double maximumValue, CGFloat canvasHeight) {
+    return SFChartGeometryNormalizedCanvasValue(value, minimumValue, maximumValue, canvasHeight);
 }
 
 SF_INLINE CGFloat xOffsetForPlotIndex(NSInteger plotIndex, NSInteger numberOfPlots, CGFloat plotWidth) {
-    CGFloat offset = 0;
-    if (numberOfPlots % 2 == 0) {
-        // Even
-        offset = (plotIndex - numberOfPlots / 2 + 0.5) * plotWidth;
-    } else {
-        // Odd
-        offset = (plotIndex - numberOfPlots / 2) * plotWidth;
-    }
-    return offset;
+    return SFChartGeometryXOffsetForPlotIndex(plotIndex, numberOfPlots, plotWidth);
+}
+
+SF_INLINE void addPointIndicatorToPath(CGMutablePathRef path, CGPoint position) {
+    const CGFloat radius = (SFGraphChartViewPointAndLineWidth - SFGraphChartViewPointIndicatorLineWidth) / 2;
+    CGPathAddEllipseInRect(path, NULL, CGRectMake(position.x - radius, position.y - radius, radius * 2, radius * 2));
 }
 
 
@@ -104,9 +138,7 @@ SF_INLINE CGFloat xOffsetForPlotIndex(NSInteger plotIndex, NSInteger numberOfPlo
 
 @property (nonatomic) NSInteger numberOfXAxisPoints;
 
-@property (nonatomic) NSMutableArray<NSMutableArray<NSObject<SFValueCollectionType> *> *> *dataPoints; // Actual data
-
-@property (nonatomic) NSMutableArray<NSMutableArray<NSObject<SFValueCollectionType> *> *> *yAxisPoints; // Normalized for the plot view height
+@property (nonatomic) NSMutableArray<SFGraphChartPlotBuffer *> *plotBuffers; // Actual data and its canvas normalization
 
 @property (nonatomic) UIView *plotView; // Holds the plots
 
@@ -124,12 +156,38 @@ SF_INLINE CGFloat xOffsetForPlotIndex(NSInteger plotIndex, NSInteger numberOfPlo
 
 - (void)calculateMinAndMaxValues;
 
-- (NSMutableArray<NSObject<SFValueCollectionType> *> *)normalizedCanvasDataPointsForPlotIndex:(NSInteger)plotIndex canvasHeight:(CGFloat)viewHeight;
+/// Values provided by the data source, or `SFDoubleInvalidValue`. Must be called on the main thread.
+- (void)getProvidedMinimumValue:(double *)minimumValue maximumValue:(double *)maximumValue;
+
+- (void)normalizeCanvasValuesForPlotIndex:(NSInteger)plotIndex canvasHeight:(CGFloat)viewHeight;
+
+- (BOOL)hasCanvasValues;
+
+- (void)valueRangeDidChange;
+
+- (void)updateNoDataLabel;
+
+/// Makes the accessibility elements format their label and value again when next read, without posting a layout change.
+- (void)_axInvalidateAccessibilityStrings;
+
+- (void)obtainDataPointsForPlotIndex:(NSInteger)plotIndex;
+
+- (void)fillPlotBuffer:(SFGraphChartPlotBuffer *)plotBuffer forPlotIndex:(NSInteger)plotIndex;
+
+- (void)updateLayersForReloadedData;
+
+- (void)appendDataPointsInRange:(NSRange)range plotIndex:(NSInteger)plotIndex toPlotBuffer:(SFGraphChartPlotBuffer *)plotBuffer;
+
+- (void)replaceDataPointsAtIndexes:(NSIndexSet *)indexes plotIndex:(NSInteger)plotIndex inPlotBuffer:(SFGraphChartPlotBuffer *)plotBuffer;
+
+- (nullable NSObject<SFValueCollectionType> *)storedDataPointForPointIndex:(NSInteger)pointIndex plotIndex:(NSInteger)plotIndex;
 
 - (NSInteger)numberOfPlots;
 
 - (NSInteger)numberOfValidValuesForPlotIndex:(NSInteger)plotIndex;
 
+- (BOOL)shouldDrawPointIndicatorForPointWithIndex:(NSInteger)pointIndex inPlotWithIndex:(NSInteger)plotIndex;
+
 - (NSInteger)scrubbingPlotIndex;
 
 - (double)scrubbingValueForPlotIndex:(NSInteger)plotIndex pointIndex:(NSInteger)pointIndex;
@@ -140,6 +198,35 @@ SF_INLINE CGFloat xOffsetForPlotIndex(NSInteger plotIndex, NSInteger numberOfPlo
 
 - (NSInteger)pointIndexForXPosition:(CGFloat)xPosition plotIndex:(NSInteger)plotIndex;
 
+/// The point of the plot at the scrubber, given the point resolved for the scrubbing plot. Returns `scrubbedPointIndex` unless overridden.
+- (NSInteger)scrubbedPointIndexForPlotIndex:(NSInteger)plotIndex xPosition:(CGFloat)xPosition scrubbedPointIndex:(NSInteger)scrubbedPointIndex;
+
+- (const CGFloat *)xAxisPositions; // Cached table of the position of every x-axis point
+
+/// The canvas x-position of every point of the plot, in ascending order. Returns `xAxisPositions` unless overridden.
+- (const CGFloat *)canvasXPositionsForPlotIndex:(NSInteger)plotIndex;
+
+- (NSInteger)numberOfCanvasXPositionsForPlotIndex:(NSInteger)plotIndex;
+
+- (NSRange)visibleXAxisPointRange; // visibleXAxisRange resolved for the number of x-axis points
+
+- (NSRange)visibleXAxisPointRangeForNumberOfXAxisPoints:(NSInteger)numberOfXAxisPoints;
+
+/// The points of the plot which are normalized and drawn: the visible points and their neighbors.
+- (NSRange)culledXAxisPointRangeForPlotIndex:(NSInteger)plotIndex;
+
+- (NSInteger)pointIndexAtOrAfterXPosition:(CGFloat)xPosition plotIndex:(NSInteger)plotIndex;
+
+- (NSInteger)pointIndexAfterXPosition:(CGFloat)xPosition plotIndex:(NSInteger)plotIndex;
+
+/// The point closest to `xPosition` in O(log n), or `NSNotFound` if it lies further than `maximumDistance` away.
+- (NSInteger)pointIndexNearestToXPosition:(CGFloat)xPosition plotIndex:(NSInteger)plotIndex maximumDistance:(CGFloat)maximumDistance;
+
+/// Hit tests a point of the plot view for the selectable point under it. Returns `NO` unless overridden.
+- (BOOL)getSelectedPointIndex:(NSInteger *)pointIndex plotIndex:(NSInteger *)plotIndex subpointIndex:(NSInteger *)subpointIndex atCanvasPoint:(CGPoint)point;
+
+- (double)canvasYPositionForXPosition:(CGFloat)xPosition plotIndex:(NSInteger)plotIndex;
+
 - (void)updateScrubberViewForXPosition:(CGFloat)xPosition plotIndex:(NSInteger)plotIndex;
 
 - (void)updateScrubberLineAccessories:(CGFloat)xPosition plotIndex:(NSInteger)plotIndex;
@@ -152,8 +239,40 @@ SF_INLINE CGFloat xOffsetForPlotIndex(NSInteger plotIndex, NSInteger numberOfPlo
 
 - (void)updateLineLayers;
 
+/// Marks the specified layout stages as invalid and schedules a layout pass to redo them.
+- (void)invalidateLayout:(SFGraphChartViewInvalidation)invalidation;
+
+- (void)layoutPlotLayers;
+
 - (void)layoutLineLayers;
 
+- (void)updateLineLayersReplacingExistingForPlotIndex:(NSInteger)plotIndex;
+
+/// Returns a line layer left over by the previous update, reset to the defaults of a new layer, or a new layer.
+/// The returned layer may still be in the plot view, so it must be added to it again.
+- (CAShapeLayer *)dequeueReusableLineLayer;
+
+/// Makes a layer which is not in `lineLayers` available to `dequeueReusableLineLayer` until the update ends.
+- (void)enqueueReusableLineLayer:(CAShapeLayer *)lineLayer;
+
+- (void)updatePlotLayers;
+
+- (void)updatePlotLayersForPlotIndex:(NSInteger)plotIndex;
+
+- (void)layoutPlotLayersForPlotIndex:(NSInteger)plotIndex;
+
+/// The number of layers and path vertices drawing the plot with vector layers. Returns the number of culled points unless overridden.
+- (NSInteger)renderingComplexityForPlotIndex:(NSInteger)plotIndex;
+
+/// Abstract. Snapshots the plot and returns a block drawing it into the tiles, or nil if the plot draws nothing.
+- (nullable SFGraphChartTileDrawingBlock)tileDrawingBlockForPlotIndex:(NSInteger)plotIndex geometry:(SFGraphChartTileGeometry)geometry;
+
+/// Draws the tiles again on the next layout of the plots, for changes which are not made through the plot layers.
+- (void)invalidateTiles;
+
+/// The content x-positions of the points of the plot, which do not move as the visible range pans, or NULL for the x-axis points. Returns NULL unless overridden.
+- (nullable const CGFloat *)tileXPositionsForPlotIndex:(NSInteger)plotIndex;
+
 - (UIColor *)colorForPlotIndex:(NSInteger)plotIndex subpointIndex:(NSInteger)subpointIndex totalSubpoints:(NSInteger)totalSubpoints;
 
 - (UIColor *)colorForPlotIndex:(NSInteger)plotIndex;
@@ -174,14 +293,30 @@ SF_INLINE CGFloat xOffsetForPlotIndex(NSInteger plotIndex, NSInteger numberOfPlo
 // Abstract base class for SFDiscreteGraphChartView and SFLineGraphChartView
 @interface SFValueRangeGraphChartView ()
 
-@property (nonatomic) NSMutableArray<NSMutableArray<SFValueRange *> *> *dataPoints; // Actual data
-
-@property (nonatomic) NSMutableArray<NSMutableArray<SFValueRange *> *> *yAxisPoints; // Normalized for the plot view height
-
 - (void)updatePointLayers;
 
+- (void)updatePointLayersForPlotIndex:(NSInteger)plotIndex;
+
 - (void)layoutPointLayers;
 
+- (void)layoutPointLayersForPlotIndex:(NSInteger)plotIndex;
+
+/// Draws the point indicators of the culled points into a single compound path.
+- (void)layoutPointPathLayer:(CAShapeLayer *)pointPathLayer forPlotIndex:(NSInteger)plotIndex xOffset:(CGFloat)xOffset;
+
+@end
+
+
+@interface SFLineGraphChartView ()
+
+- (NSInteger)downsamplingBucketCountForPlotIndex:(NSInteger)plotIndex;
+
+/// Whether the segment joining two consecutive drawn points is dashed. Returns `followsUnsetValues` unless overridden.
+- (BOOL)drawsGapFromPointIndex:(NSInteger)previousPointIndex toPointIndex:(NSInteger)pointIndex plotIndex:(NSInteger)plotIndex followingUnsetValues:(BOOL)followsUnsetValues;
+
+/// The widest segment tiles draw solid, or 0 to dash the segments spanning unset values. The tiled counterpart of `drawsGapFromPointIndex:toPointIndex:plotIndex:followingUnsetValues:`.
+- (CGFloat)maximumSolidSegmentWidthForPlotIndex:(NSInteger)plotIndex;
+
 @end
 
 NS_ASSUME_NONNULL_END
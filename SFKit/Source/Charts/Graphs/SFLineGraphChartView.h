@@ -46,6 +46,51 @@ NS_ASSUME_NONNULL_BEGIN
 SF_CLASS_AVAILABLE
 @interface SFLineGraphChartView : SFValueRangeGraphChartView
 
+/**
+ The number of most recent values plotted for each plot in streaming mode.
+ 
+ Setting this property to a positive value enables streaming mode and reloads the graph chart view.
+ In streaming mode, only the most recent `streamingWindowSize` points of each plot are obtained from
+ the data source, and new values are added with the `appendStreamingValue:toPlot:` method instead of
+ reloading the data. Each plot spans `streamingWindowSize` x-axis points.
+ 
+ Point indicators are not drawn and batch updates are not available in streaming mode. Implement the
+ `minimumValueForGraphChartView:` and `maximumValueForGraphChartView:` methods of the data source to
+ keep appended values outside of the plotted range, and discarded values at its limits, from
+ re-plotting every plot.
+ 
+ The default value of this property is 0, which disables streaming mode.
+ */
+@property (nonatomic) NSInteger streamingWindowSize;
+
+/**
+ A Boolean value indicating whether plots with many more points than horizontal pixels are
+ downsampled before their lines are drawn.
+ 
+ When this property is `YES`, each plot holding more than twice as many valid values as the plot area
+ is wide in pixels is reduced to the lowest and highest value of each pixel column, so the drawn lines
+ keep their visual extremes while the number of drawn segments is bounded by the width of the view.
+ Point indicators are only drawn for the values kept. Scrubbing still reports the exact values of every point. Downsampling does not apply in streaming mode.
+ 
+ The default value of this property is `NO`.
+ */
+@property (nonatomic) BOOL downsamplesPlots;
+
+/**
+ Appends a value to the specified plot in streaming mode.
+ 
+ Once the plot holds `streamingWindowSize` values, the oldest value is discarded and the plot scrolls
+ one x-axis point to the left. Only the line segment leading to the appended value is drawn, making
+ appending cost constant time regardless of the window size.
+ 
+ The data source is not asked for the appended value. If you reload the graph chart view, the data
+ source should provide the appended values as the last points of the plot.
+ 
+ @param value               The value to append, or `SFDoubleInvalidValue` to append an unset value.
+ @param plotIndex           An index number identifying the plot in the graph chart view.
+ */
+- (void)appendStreamingValue:(double)value toPlot:(NSInteger)plotIndex;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -99,8 +99,160 @@
 
 const CGFloat FillColorAlpha = 0.4;
 
+// State of a path walked to derive the keyframes of a stroke end sweeping across x
+typedef struct SFLineGraphStrokeWalk {
+    CGFloat length; // Of the path walked so far
+    CGPoint currentPoint;
+    CGFloat totalLength;
+    CGFloat minimumX;
+    CGFloat width;
+    CGFloat keyframeX; // Of the last keyframe
+    BOOL hasPendingKeyframe; // Whether the current point is a vertex without a keyframe
+    __unsafe_unretained NSMutableArray<NSNumber *> *keyTimes; // nil while measuring the path
+    __unsafe_unretained NSMutableArray<NSNumber *> *values;
+} SFLineGraphStrokeWalk;
+
+static void addStrokeKeyframe(SFLineGraphStrokeWalk *walk, CGFloat x) {
+    [walk->keyTimes addObject:@(MAX(0, MIN(1, (x - walk->minimumX) / walk->width)))];
+    [walk->values addObject:@(walk->length / walk->totalLength)];
+    walk->keyframeX = x;
+    walk->hasPendingKeyframe = NO;
+}
+
+static void walkStrokePathElement(void *info, const CGPathElement *element) {
+    SFLineGraphStrokeWalk *walk = info;
+    CGPoint point = CGPointZero;
+    switch (element->type) {
+        case kCGPathElementMoveToPoint:
+        case kCGPathElementAddLineToPoint:
+            point = element->points[0];
+            break;
+        case kCGPathElementAddQuadCurveToPoint:
+            point = element->points[1];
+            break;
+        case kCGPathElementAddCurveToPoint:
+            point = element->points[2];
+            break;
+        case kCGPathElementCloseSubpath:
+            return;
+    }
+    
+    if (element->type == kCGPathElementMoveToPoint) {
+        if (walk->keyTimes) {
+            // The stroke rests at the end of the previous subpath until the sweep reaches this one
+            if (walk->hasPendingKeyframe) {
+                addStrokeKeyframe(walk, walk->currentPoint.x);
+            }
+            addStrokeKeyframe(walk, point.x);
+        }
+    } else {
+        // Graph lines are straight, so curves are measured by their chord
+        walk->length += hypot(point.x - walk->currentPoint.x, point.y - walk->currentPoint.y);
+        if (walk->keyTimes) {
+            // At most one keyframe per pixel column, besides the ends of the subpaths
+            walk->hasPendingKeyframe = YES;
+            if (point.x - walk->keyframeX >= scalePixelAdjustment()) {
+                addStrokeKeyframe(walk, point.x);
+            }
+        }
+    }
+    walk->currentPoint = point;
+}
+
+/**
+ A stroke end animation which draws `path` in as a vertical sweep moves from `minimumX` to `maximumX`,
+ so several layers animated over the same x range reach each x position at the same time. Returns nil
+ if the path has no length or the x range no width.
+ */
+static CAAnimation *sweepingStrokeEndAnimation(CGPathRef path, CGFloat minimumX, CGFloat maximumX, NSTimeInterval duration) {
+    SFLineGraphStrokeWalk walk = {0};
+    CGPathApply(path, &walk, walkStrokePathElement);
+    if (walk.length <= 0 || maximumX <= minimumX) {
+        return nil;
+    }
+    
+    NSMutableArray<NSNumber *> *keyTimes = [NSMutableArray new];
+    NSMutableArray<NSNumber *> *values = [NSMutableArray new];
+    walk = (SFLineGraphStrokeWalk){
+        .totalLength = walk.length,
+        .minimumX = minimumX,
+        .width = maximumX - minimumX,
+        .keyTimes = keyTimes,
+        .values = values
+    };
+    addStrokeKeyframe(&walk, minimumX);
+    CGPathApply(path, &walk, walkStrokePathElement);
+    if (walk.hasPendingKeyframe) {
+        addStrokeKeyframe(&walk, walk.currentPoint.x);
+    }
+    addStrokeKeyframe(&walk, maximumX);
+    
+    CAKeyframeAnimation *animation = [CAKeyframeAnimation animationWithKeyPath:@"strokeEnd"];
+    animation.keyTimes = keyTimes;
+    animation.values = values;
+    animation.beginTime = CACurrentMediaTime();
+    animation.duration = duration;
+    animation.fillMode = kCAFillModeForwards;
+    animation.removedOnCompletion = NO;
+    return animation;
+}
+
+// Layers and scroll state of a plot in streaming mode
+@interface SFLineGraphStreamingPlot : NSObject
+
+@property (nonatomic) CALayer *contentLayer; // Translated to scroll the plot
+
+@property (nonatomic) NSMutableArray<NSMutableArray<CAShapeLayer *> *> *fillLayers; // Parallel to the line layers of the plot
+
+@property (nonatomic) NSMutableArray<CAShapeLayer *> *reusableLayers;
+
+@property (nonatomic) NSInteger firstSampleIndex; // Number of values streamed before the first plotted one
+
+@property (nonatomic) NSInteger originSampleIndex; // Sample index at the origin of the content layer
+
+@property (nonatomic) NSInteger lastValidSampleIndex;
+
+@end
+
+
+@implementation SFLineGraphStreamingPlot
+
+- (instancetype)init {
+    self = [super init];
+    if (self) {
+        _contentLayer = [CALayer layer];
+        _fillLayers = [NSMutableArray new];
+        _reusableLayers = [NSMutableArray new];
+        _lastValidSampleIndex = NSNotFound;
+    }
+    return self;
+}
+
+- (CAShapeLayer *)dequeueReusableLayer {
+    CAShapeLayer *layer = _reusableLayers.lastObject;
+    if (layer) {
+        [_reusableLayers removeLastObject];
+        [layer removeAllAnimations];
+        layer.strokeEnd = 1.0;
+        layer.opacity = 1.0;
+        layer.lineDashPattern = nil;
+    } else {
+        layer = graphLineLayer();
+    }
+    return layer;
+}
+
+- (void)enqueueReusableLayers:(NSArray<CAShapeLayer *> *)layers {
+    [layers makeObjectsPerformSelector:@selector(removeFromSuperlayer)];
+    [_reusableLayers addObjectsFromArray:layers];
+}
+
+@end
+
+
 @implementation SFLineGraphChartView {
     NSMutableDictionary *_fillLayers;
+    NSMutableDictionary<NSNumber *, SFLineGraphStreamingPlot *> *_streamingPlots;
 }
 
 #pragma mark - Init
@@ -108,9 +260,14 @@ const CGFloat FillColorAlpha = 0.4;
 - (void)sharedInit {
     [super sharedInit];
     _fillLayers = [NSMutableDictionary new];
+    _streamingPlots = [NSMutableDictionary new];
 }
 
 - (BOOL)shouldDrawLinesForPlotIndex:(NSInteger)plotIndex {
+    if (_streamingWindowSize > 0) {
+        // Segments are added as values stream in
+        return YES;
+    }
     return [self numberOfValidValuesForPlotIndex:plotIndex] > 1;
 }
 
@@ -130,111 +287,589 @@ const CGFloat FillColorAlpha = 0.4;
     [super updatePlotColors];
     NSInteger numberOfPlots = [self numberOfPlots];
     for (NSUInteger plotIndex = 0; plotIndex < numberOfPlots; plotIndex++) {
+        CGColorRef fillColor = [self fillColorForPlotIndex:plotIndex].CGColor;
         CAShapeLayer *fillLayer = _fillLayers[@(plotIndex)];
-        fillLayer.fillColor = [self fillColorForPlotIndex:plotIndex].CGColor;
+        fillLayer.fillColor = fillColor;
+        for (NSArray<CAShapeLayer *> *segmentFillLayers in _streamingPlots[@(plotIndex)].fillLayers) {
+            for (CAShapeLayer *segmentFillLayer in segmentFillLayers) {
+                segmentFillLayer.fillColor = fillColor;
+            }
+        }
     }
 }
 
 - (void)updateLineLayers {
-    [_fillLayers.allValues makeObjectsPerformSelector:@selector(removeFromSuperlayer)];
+    // Fill layers are reused as line layers by the update
+    for (CAShapeLayer *fillLayer in _fillLayers.allValues) {
+        [self enqueueReusableLineLayer:fillLayer];
+    }
     [_fillLayers removeAllObjects];
+    for (SFLineGraphStreamingPlot *streamingPlot in _streamingPlots.allValues) {
+        [streamingPlot.contentLayer removeFromSuperlayer];
+    }
+    [_streamingPlots removeAllObjects];
     [super updateLineLayers];
 }
 
+- (void)updateLineLayersReplacingExistingForPlotIndex:(NSInteger)plotIndex {
+    if (_fillLayers[@(plotIndex)]) {
+        [self enqueueReusableLineLayer:_fillLayers[@(plotIndex)]];
+        [_fillLayers removeObjectForKey:@(plotIndex)];
+    }
+    [_streamingPlots[@(plotIndex)].contentLayer removeFromSuperlayer];
+    [_streamingPlots removeObjectForKey:@(plotIndex)];
+    [super updateLineLayersReplacingExistingForPlotIndex:plotIndex];
+}
+
+- (void)updatePointLayersForPlotIndex:(NSInteger)plotIndex {
+    if (_streamingWindowSize > 0) {
+        // Point indicators are not drawn in streaming mode
+        return;
+    }
+    [super updatePointLayersForPlotIndex:plotIndex];
+}
+
+- (void)layoutPointLayersForPlotIndex:(NSInteger)plotIndex {
+    if (_streamingWindowSize > 0) {
+        return;
+    }
+    [super layoutPointLayersForPlotIndex:plotIndex];
+}
+
 - (void)updateLineLayersForPlotIndex:(NSInteger)plotIndex {
+    if (_streamingWindowSize > 0) {
+        [self updateStreamingLineLayersForPlotIndex:plotIndex];
+        return;
+    }
+
     // Fill
-    CAShapeLayer *fillLayer = [CAShapeLayer layer];
+    CAShapeLayer *fillLayer = [self dequeueReusableLineLayer];
     fillLayer.fillColor = [self fillColorForPlotIndex:plotIndex].CGColor;
     
     [self.plotView.layer addSublayer:fillLayer];
     _fillLayers[@(plotIndex)] = fillLayer;
 
-    // Lines
+    // Lines, drawn as a single path for the solid segments and another one for the dashed segments spanning unset values
+    CGColorRef strokeColor = [self colorForPlotIndex:plotIndex].CGColor;
+    CAShapeLayer *solidLineLayer = [self dequeueReusableLineLayer];
+    setUpGraphLineLayer(solidLineLayer);
+    solidLineLayer.strokeColor = strokeColor;
+    solidLineLayer.lineWidth = 2.0;
+    
+    CAShapeLayer *dashedLineLayer = [self dequeueReusableLineLayer];
+    setUpGraphLineLayer(dashedLineLayer);
+    dashedLineLayer.strokeColor = strokeColor;
+    dashedLineLayer.lineWidth = 2.0;
+    dashedLineLayer.lineDashPattern = @[@12, @6];
+    
+    [self.plotView.layer addSublayer:solidLineLayer];
+    [self.plotView.layer addSublayer:dashedLineLayer];
+    [self.lineLayers[plotIndex] addObject:[@[solidLineLayer, dashedLineLayer] mutableCopy]];
+}
+
+- (NSInteger)downsamplingBucketCountForPlotIndex:(NSInteger)plotIndex {
+    if (!_downsamplesPlots || _streamingWindowSize > 0) {
+        return 0;
+    }
+    // One bucket per pixel column; a single bucket stands in until the plot view is laid out
+    NSInteger bucketCount = MAX(1, (NSInteger)ceil(self.plotView.bounds.size.width / scalePixelAdjustment()));
+    NSInteger numberOfCulledValues = [self culledXAxisPointRangeForPlotIndex:plotIndex].length;
+    if (MIN(self.plotBuffers[plotIndex].numberOfValidValues, numberOfCulledValues) <= 2 * bucketCount) {
+        return 0;
+    }
+    return bucketCount;
+}
+
+- (void)setDownsamplesPlots:(BOOL)downsamplesPlots {
+    _downsamplesPlots = downsamplesPlots;
+    [self invalidateLayout:SFGraphChartViewInvalidationData];
+}
+
+- (void)layoutLineLayersForPlotIndex:(NSInteger)plotIndex {
+    if (_streamingWindowSize > 0) {
+        [self layoutStreamingLineLayersForPlotIndex:plotIndex];
+        return;
+    }
+    
+    CAShapeLayer *fillLayer = _fillLayers[@(plotIndex)];
+    
+    if (fillLayer == nil) {
+        // Skip for a nil fillLayer
+        return;
+    }
+    
+    SFGraphChartPlotBuffer *plotBuffer = self.plotBuffers[plotIndex];
+    NSRange culledRange = [self culledXAxisPointRangeForPlotIndex:plotIndex];
+    
+    // The sampled indexes follow the pixel columns and visible points of the current layout
+    NSInteger bucketCount = [self downsamplingBucketCountForPlotIndex:plotIndex];
+    BOOL isDownsampled = (bucketCount > 0);
+    if (isDownsampled) {
+        [plotBuffer sampleExtremaInRange:culledRange numberOfBuckets:bucketCount];
+    }
+    
+    const CGFloat *xPositions = [self canvasXPositionsForPlotIndex:plotIndex];
+    CGFloat fillBottom = CGRectGetHeight(self.plotView.frame) + scalePixelAdjustment();
+    CGMutablePathRef solidPath = CGPathCreateMutable();
+    CGMutablePathRef dashedPath = CGPathCreateMutable();
+    CGMutablePathRef fillPath = CGPathCreateMutable();
+    CGPoint previousPoint = CGPointZero;
+    NSInteger previousPointIndex = NSNotFound;
     BOOL previousPointExists = NO;
     BOOL emptyDataPresent = NO;
-    NSUInteger pointCount = self.dataPoints[plotIndex].count;
-    for (NSUInteger pointIndex = 0; pointIndex < pointCount; pointIndex++) {
-        [self.lineLayers[plotIndex] addObject:[NSMutableArray new]];
-        if (self.dataPoints[plotIndex][pointIndex].isUnset) {
+    BOOL solidSubpathIsOpen = NO;
+    NSInteger firstDrawnPointIndex = isDownsampled ? 0 : culledRange.location;
+    NSInteger endDrawnPointIndex = isDownsampled ? plotBuffer.numberOfSampledIndexes : NSMaxRange(culledRange);
+    for (NSInteger drawnPointIndex = firstDrawnPointIndex; drawnPointIndex < endDrawnPointIndex; drawnPointIndex++) {
+        NSInteger pointIndex = drawnPointIndex;
+        if (isDownsampled) {
+            // Sampled indexes only address valid values
+            pointIndex = plotBuffer.sampledIndexes[drawnPointIndex];
+            emptyDataPresent = emptyDataPresent || plotBuffer.sampledIndexesFollowGaps[drawnPointIndex];
+        } else if ([plotBuffer isUnsetAtIndex:pointIndex]) {
             emptyDataPresent = YES;
             continue;
         }
         
+        CGPoint point = CGPointMake(xPositions[pointIndex],
+                                    plotBuffer.canvasMinimumValues[pointIndex]);
         if (!previousPointExists) {
+            // Substract scalePixelAdjustment() to the first horizontal position of the fillPath so if fully covers the start of the x axis
+            CGPathMoveToPoint(fillPath, NULL, point.x - scalePixelAdjustment(), fillBottom);
+            CGPathAddLineToPoint(fillPath, NULL, point.x - scalePixelAdjustment(), point.y);
             previousPointExists = YES;
-            emptyDataPresent = NO;
+        } else {
+            if ([self drawsGapFromPointIndex:previousPointIndex toPointIndex:pointIndex plotIndex:plotIndex followingUnsetValues:emptyDataPresent]) {
+                CGPathMoveToPoint(dashedPath, NULL, previousPoint.x, previousPoint.y);
+                CGPathAddLineToPoint(dashedPath, NULL, point.x, point.y);
+                solidSubpathIsOpen = NO;
+            } else {
+                if (!solidSubpathIsOpen) {
+                    CGPathMoveToPoint(solidPath, NULL, previousPoint.x, previousPoint.y);
+                    solidSubpathIsOpen = YES;
+                }
+                CGPathAddLineToPoint(solidPath, NULL, point.x, point.y);
+            }
+            // Add scalePixelAdjustment() to the last vertical position of the fillPath so if fully covers the end of the x axis
+            CGPathAddLineToPoint(fillPath, NULL, point.x + ( (drawnPointIndex == (endDrawnPointIndex - 1)) ? scalePixelAdjustment() : 0 ), point.y);
+        }
+        emptyDataPresent = NO;
+        previousPoint = point;
+        previousPointIndex = pointIndex;
+    }
+    
+    CGPathAddLineToPoint(fillPath, NULL, previousPoint.x + scalePixelAdjustment(), fillBottom);
+    
+    CAShapeLayer *solidLineLayer = self.lineLayers[plotIndex][0][0];
+    CAShapeLayer *dashedLineLayer = self.lineLayers[plotIndex][0][1];
+    solidLineLayer.path = solidPath;
+    dashedLineLayer.path = dashedPath;
+    fillLayer.path = fillPath;
+    CGPathRelease(solidPath);
+    CGPathRelease(dashedPath);
+    CGPathRelease(fillPath);
+}
+
+- (BOOL)drawsGapFromPointIndex:(NSInteger)previousPointIndex toPointIndex:(NSInteger)pointIndex plotIndex:(NSInteger)plotIndex followingUnsetValues:(BOOL)followsUnsetValues {
+    return followsUnsetValues;
+}
+
+- (void)layoutPointPathLayer:(CAShapeLayer *)pointPathLayer forPlotIndex:(NSInteger)plotIndex xOffset:(CGFloat)xOffset {
+    NSInteger bucketCount = [self downsamplingBucketCountForPlotIndex:plotIndex];
+    if (bucketCount == 0) {
+        [super layoutPointPathLayer:pointPathLayer forPlotIndex:plotIndex xOffset:xOffset];
+        return;
+    }
+    
+    // Downsampled plots only draw the point indicators of their sampled values
+    SFGraphChartPlotBuffer *plotBuffer = self.plotBuffers[plotIndex];
+    if (![self shouldDrawLinesForPlotIndex:plotIndex] || _fillLayers[@(plotIndex)] == nil) {
+        // The values are sampled by the line layout otherwise
+        [plotBuffer sampleExtremaInRange:[self culledXAxisPointRangeForPlotIndex:plotIndex] numberOfBuckets:bucketCount];
+    }
+    const CGFloat *xPositions = [self canvasXPositionsForPlotIndex:plotIndex];
+    CGMutablePathRef pointPath = CGPathCreateMutable();
+    for (NSInteger sampledIndex = 0; sampledIndex < plotBuffer.numberOfSampledIndexes; sampledIndex++) {
+        NSInteger pointIndex = plotBuffer.sampledIndexes[sampledIndex];
+        if (![self shouldDrawPointIndicatorForPointWithIndex:pointIndex inPlotWithIndex:plotIndex]) {
             continue;
         }
+        CGFloat positionOnXAxis = xPositions[pointIndex] + xOffset;
+        addPointIndicatorToPath(pointPath, CGPointMake(positionOnXAxis, plotBuffer.canvasMinimumValues[pointIndex]));
+        if (plotBuffer.minimumValues[pointIndex] != plotBuffer.maximumValues[pointIndex]) {
+            addPointIndicatorToPath(pointPath, CGPointMake(positionOnXAxis, plotBuffer.canvasMaximumValues[pointIndex]));
+        }
+    }
+    pointPathLayer.path = pointPath;
+    CGPathRelease(pointPath);
+}
+
+#pragma mark - Tiled Rendering
+
+- (NSInteger)renderingComplexityForPlotIndex:(NSInteger)plotIndex {
+    if (_streamingWindowSize > 0) {
+        // Streaming plots scroll their segment layers rather than drawing them again
+        return 0;
+    }
+    NSInteger bucketCount = [self downsamplingBucketCountForPlotIndex:plotIndex];
+    if (bucketCount > 0) {
+        // The minimum and maximum value of each bucket are drawn, along with their point indicators
+        // unless the data source turns them off; the ends of the range only add two
+        BOOL drawsPointIndicators = YES;
+        if ([self.dataSource respondsToSelector:@selector(graphChartView:drawsPointIndicatorsForPlotIndex:)]) {
+            drawsPointIndicators = [self.dataSource graphChartView:self drawsPointIndicatorsForPlotIndex:plotIndex];
+        }
+        return (drawsPointIndicators ? 4 : 2) * bucketCount;
+    }
+    return [super renderingComplexityForPlotIndex:plotIndex];
+}
+
+- (CGFloat)maximumSolidSegmentWidthForPlotIndex:(NSInteger)plotIndex {
+    return 0;
+}
+
+- (SFGraphChartTileDrawingBlock)tileDrawingBlockForPlotIndex:(NSInteger)plotIndex geometry:(SFGraphChartTileGeometry)geometry {
+    if (![self shouldDrawLinesForPlotIndex:plotIndex]) {
+        return nil;
+    }
+    
+    // Unset values have an unset minimum value, so only the minimum values are copied
+    NSData *valueData = [NSData dataWithBytes:self.plotBuffers[plotIndex].minimumValues length:geometry.numberOfPoints * sizeof(double)];
+    UIColor *strokeColor = [self colorForPlotIndex:plotIndex];
+    UIColor *fillColor = [self fillColorForPlotIndex:plotIndex];
+    CGFloat maximumSolidSegmentWidth = [self maximumSolidSegmentWidthForPlotIndex:plotIndex];
+    CGFloat pixelAdjustment = scalePixelAdjustment();
+    return ^(CGContextRef context, CGRect rect) {
+        const double *values = valueData.bytes;
+        NSRange pointRange = SFGraphChartTilePointRange(&geometry, CGRectGetMinX(rect), CGRectGetMaxX(rect));
+        if (pointRange.length == 0) {
+            // Prefetched tiles can lie past the last point
+            return;
+        }
+        // The fill and the lines continue over unset values to the closest values outside of the tile
+        NSInteger startIndex = MIN((NSInteger)pointRange.location, geometry.numberOfPoints - 1);
+        while (startIndex > 0 && values[startIndex] == SFDoubleInvalidValue) {
+            startIndex--;
+        }
+        NSInteger endIndex = NSMaxRange(pointRange);
+        while (endIndex < geometry.numberOfPoints && values[endIndex - 1] == SFDoubleInvalidValue) {
+            endIndex++;
+        }
         
-        CAShapeLayer *lineLayer = graphLineLayer();
-        lineLayer.strokeColor = [self colorForPlotIndex:plotIndex].CGColor;
-        lineLayer.lineWidth = 2.0;
-        
-        if (emptyDataPresent) {
-            lineLayer.lineDashPattern = @[@12, @6];
+        CGFloat fillBottom = geometry.canvasHeight + pixelAdjustment;
+        CGMutablePathRef solidPath = CGPathCreateMutable();
+        CGMutablePathRef dashedPath = CGPathCreateMutable();
+        CGMutablePathRef fillPath = CGPathCreateMutable();
+        CGPoint previousPoint = CGPointZero;
+        BOOL previousPointExists = NO;
+        BOOL emptyDataPresent = NO;
+        BOOL solidSubpathIsOpen = NO;
+        for (NSInteger pointIndex = startIndex; pointIndex < endIndex; pointIndex++) {
+            if (values[pointIndex] == SFDoubleInvalidValue) {
+                emptyDataPresent = YES;
+                continue;
+            }
+            CGPoint point = CGPointMake(SFGraphChartTileXPosition(&geometry, pointIndex),
+                                        SFGraphChartTileYPosition(&geometry, values[pointIndex]));
+            if (!previousPointExists) {
+                CGFloat fillStart = (pointIndex == 0) ? point.x - pixelAdjustment : point.x;
+                CGPathMoveToPoint(fillPath, NULL, fillStart, fillBottom);
+                CGPathAddLineToPoint(fillPath, NULL, fillStart, point.y);
+                previousPointExists = YES;
+            } else {
+                BOOL drawsGap = (maximumSolidSegmentWidth > 0) ? (point.x - previousPoint.x > maximumSolidSegmentWidth) : emptyDataPresent;
+                if (drawsGap) {
+                    CGPathMoveToPoint(dashedPath, NULL, previousPoint.x, previousPoint.y);
+                    CGPathAddLineToPoint(dashedPath, NULL, point.x, point.y);
+                    solidSubpathIsOpen = NO;
+                } else {
+                    if (!solidSubpathIsOpen) {
+                        CGPathMoveToPoint(solidPath, NULL, previousPoint.x, previousPoint.y);
+                        solidSubpathIsOpen = YES;
+                    }
+                    CGPathAddLineToPoint(solidPath, NULL, point.x, point.y);
+                }
+                CGPathAddLineToPoint(fillPath, NULL, point.x, point.y);
+            }
             emptyDataPresent = NO;
+            previousPoint = point;
         }
+        if (previousPointExists) {
+            CGFloat fillEnd = (endIndex == geometry.numberOfPoints) ? previousPoint.x + pixelAdjustment : previousPoint.x;
+            CGPathAddLineToPoint(fillPath, NULL, fillEnd, previousPoint.y);
+            CGPathAddLineToPoint(fillPath, NULL, fillEnd, fillBottom);
+        }
+        
+        CGContextAddPath(context, fillPath);
+        CGContextSetFillColorWithColor(context, fillColor.CGColor);
+        CGContextFillPath(context);
         
-        [self.plotView.layer addSublayer:lineLayer];
-        [self.lineLayers[plotIndex][pointIndex - 1] addObject:lineLayer];
+        CGContextSetStrokeColorWithColor(context, strokeColor.CGColor);
+        CGContextSetLineWidth(context, 2.0);
+        CGContextSetLineJoin(context, kCGLineJoinRound);
+        CGContextSetLineCap(context, kCGLineCapRound);
+        CGContextAddPath(context, solidPath);
+        CGContextStrokePath(context);
+        const CGFloat dashLengths[] = {12, 6};
+        CGContextSetLineDash(context, 0, dashLengths, 2);
+        CGContextAddPath(context, dashedPath);
+        CGContextStrokePath(context);
+        
+        CGPathRelease(solidPath);
+        CGPathRelease(dashedPath);
+        CGPathRelease(fillPath);
+    };
+}
+
+#pragma mark - Streaming
+
+- (void)setStreamingWindowSize:(NSInteger)streamingWindowSize {
+    if (streamingWindowSize < 0) {
+        @throw [NSException exceptionWithName:NSInvalidArgumentException
+                                       reason:@"streamingWindowSize cannot be lower than 0"
+                                     userInfo:nil];
     }
+    _streamingWindowSize = streamingWindowSize;
+    [self reloadData];
 }
 
-- (void)layoutLineLayersForPlotIndex:(NSInteger)plotIndex {
-    CAShapeLayer *fillLayer = _fillLayers[@(plotIndex)];
+- (NSInteger)numberOfXAxisPoints {
+    if (_streamingWindowSize > 0) {
+        return _streamingWindowSize;
+    }
+    return [super numberOfXAxisPoints];
+}
+
+- (NSRange)visibleXAxisPointRangeForNumberOfXAxisPoints:(NSInteger)numberOfXAxisPoints {
+    if (_streamingWindowSize > 0) {
+        // The streaming window is always displayed as a whole
+        return NSMakeRange(0, numberOfXAxisPoints);
+    }
+    return [super visibleXAxisPointRangeForNumberOfXAxisPoints:numberOfXAxisPoints];
+}
+
+- (void)fillPlotBuffer:(SFGraphChartPlotBuffer *)plotBuffer forPlotIndex:(NSInteger)plotIndex {
+    [super fillPlotBuffer:plotBuffer forPlotIndex:plotIndex];
+    if (_streamingWindowSize > 0) {
+        [plotBuffer beginStreamingWithWindowSize:_streamingWindowSize];
+    }
+}
+
+- (void)performBatchUpdates:(void (NS_NOESCAPE ^)(void))updates {
+    if (_streamingWindowSize > 0) {
+        @throw [NSException exceptionWithName:NSInternalInconsistencyException
+                                       reason:@"Batch updates are not available in streaming mode"
+                                     userInfo:nil];
+    }
+    [super performBatchUpdates:updates];
+}
+
+- (CGFloat)streamingSampleWidth {
+    return self.plotView.bounds.size.width / MAX(1, _streamingWindowSize - 1);
+}
+
+- (void)appendStreamingValue:(double)value toPlot:(NSInteger)plotIndex {
+    if (_streamingWindowSize == 0) {
+        @throw [NSException exceptionWithName:NSInternalInconsistencyException
+                                       reason:@"Values can only be appended in streaming mode"
+                                     userInfo:nil];
+    }
+    if (plotIndex < 0 || plotIndex >= self.plotBuffers.count) {
+        @throw [NSException exceptionWithName:NSRangeException
+                                       reason:[NSString stringWithFormat:@"Plot index %ld beyond bounds [0 .. %ld]", (long)plotIndex, (long)self.plotBuffers.count - 1]
+                                     userInfo:nil];
+    }
     
-    if (fillLayer == nil) {
-        // Skip for a nil fillLayer
+    SFGraphChartPlotBuffer *plotBuffer = self.plotBuffers[plotIndex];
+    SFLineGraphStreamingPlot *streamingPlot = _streamingPlots[@(plotIndex)];
+    NSMutableArray<NSMutableArray<CAShapeLayer *> *> *plotLineLayers = self.lineLayers[plotIndex];
+    
+    // Streamed value ranges hold a single value
+    double evictedValue = (plotBuffer.count == _streamingWindowSize) ? plotBuffer.minimumValues[0] : SFDoubleInvalidValue;
+    if ([plotBuffer streamMinimumValue:value maximumValue:value]) {
+        streamingPlot.firstSampleIndex++;
+        [streamingPlot enqueueReusableLayers:plotLineLayers.firstObject];
+        [streamingPlot enqueueReusableLayers:streamingPlot.fillLayers.firstObject];
+        [plotLineLayers removeObjectAtIndex:0];
+        [streamingPlot.fillLayers removeObjectAtIndex:0];
+    }
+    [plotLineLayers addObject:[NSMutableArray new]];
+    [streamingPlot.fillLayers addObject:[NSMutableArray new]];
+    
+    NSInteger pointIndex = plotBuffer.count - 1;
+    NSInteger sampleIndex = streamingPlot.firstSampleIndex + pointIndex;
+    // The points shift under the accessibility elements once the window is full; O(1), so it keeps up with the sample rate
+    [self _axInvalidateAccessibilityStrings];
+    BOOL valueRangeChanged = [self updateValueRangeWithStreamingValue:value evictedValue:evictedValue];
+    if (value != SFDoubleInvalidValue) {
+        if (streamingPlot.lastValidSampleIndex != NSNotFound && streamingPlot.lastValidSampleIndex >= streamingPlot.firstSampleIndex) {
+            // Add the segment leading to the appended value; it is owned by the preceding point
+            CAShapeLayer *fillLayer = [streamingPlot dequeueReusableLayer];
+            fillLayer.fillColor = [self fillColorForPlotIndex:plotIndex].CGColor;
+            fillLayer.strokeColor = nil;
+            [streamingPlot.contentLayer insertSublayer:fillLayer atIndex:0];
+            [streamingPlot.fillLayers[pointIndex - 1] addObject:fillLayer];
+            
+            CAShapeLayer *lineLayer = [streamingPlot dequeueReusableLayer];
+            lineLayer.fillColor = [UIColor clearColor].CGColor;
+            lineLayer.strokeColor = [self colorForPlotIndex:plotIndex].CGColor;
+            lineLayer.lineWidth = 2.0;
+            if (sampleIndex - streamingPlot.lastValidSampleIndex > 1) {
+                lineLayer.lineDashPattern = @[@12, @6];
+            }
+            [streamingPlot.contentLayer addSublayer:lineLayer];
+            [plotLineLayers[pointIndex - 1] addObject:lineLayer];
+        }
+        
+        if (!self.hasDataPoints) {
+            self.hasDataPoints = YES;
+            [self updateNoDataLabel];
+        }
+    }
+    NSInteger previousValidSampleIndex = streamingPlot.lastValidSampleIndex;
+    if (value != SFDoubleInvalidValue) {
+        streamingPlot.lastValidSampleIndex = sampleIndex;
+    }
+    
+    if (valueRangeChanged || !plotBuffer.hasCanvasValues) {
+        // The plots are re-plotted on the next layout pass
+        [self invalidateLayout:SFGraphChartViewInvalidationData];
         return;
     }
     
-    UIBezierPath *fillPath = [UIBezierPath bezierPath];
-    CGFloat positionOnXAxis = SFCGFloatInvalidValue;
-    SFValueRange *positionOnYAxis = nil;
-    BOOL previousPointExists = NO;
-    NSUInteger numberOfPoints = self.lineLayers[plotIndex].count;
-    for (NSUInteger pointIndex = 0; pointIndex < numberOfPoints; pointIndex++) {
-        if (self.dataPoints[plotIndex][pointIndex].isUnset) {
+    CGFloat canvasHeight = self.plotView.bounds.size.height;
+    double canvasValue = (value == SFDoubleInvalidValue) ? canvasHeight : normalizedCanvasValue(value, self.minimumValue, self.maximumValue, canvasHeight);
+    plotBuffer.canvasMinimumValues[pointIndex] = plotBuffer.canvasMaximumValues[pointIndex] = canvasValue;
+    plotBuffer.canvasValuesRange = NSMakeRange(0, plotBuffer.count);
+    
+    [CATransaction begin];
+    [CATransaction setDisableActions:YES];
+    if (streamingPlot.firstSampleIndex - streamingPlot.originSampleIndex >= _streamingWindowSize) {
+        // Rebase the content layer once per window to keep its coordinates small
+        [self layoutStreamingLineLayersForPlotIndex:plotIndex];
+    } else {
+        if (plotLineLayers.count > 1 && plotLineLayers[pointIndex - 1].count > 0) {
+            NSInteger previousPointIndex = previousValidSampleIndex - streamingPlot.firstSampleIndex;
+            [self layoutStreamingSegmentFromPointIndex:previousPointIndex toPointIndex:pointIndex plotIndex:plotIndex];
+        }
+        [self layoutStreamingContentLayerForPlotIndex:plotIndex];
+    }
+    [CATransaction commit];
+}
+
+- (BOOL)updateValueRangeWithStreamingValue:(double)value evictedValue:(double)evictedValue {
+    double previousMinimumValue = self.minimumValue;
+    double previousMaximumValue = self.maximumValue;
+    if (evictedValue != SFDoubleInvalidValue && (evictedValue <= previousMinimumValue || evictedValue >= previousMaximumValue)) {
+        // The evicted value may have been the last one at a limit, so the limits are resolved again
+        // from the range extrema of the streaming windows, in O(log n) per plot
+        [self calculateMinAndMaxValues];
+    } else if (value != SFDoubleInvalidValue) {
+        if (![self.dataSource respondsToSelector:@selector(minimumValueForGraphChartView:)] && value < previousMinimumValue) {
+            self.minimumValue = value;
+        }
+        if (![self.dataSource respondsToSelector:@selector(maximumValueForGraphChartView:)] && value > previousMaximumValue) {
+            self.maximumValue = value;
+        }
+    }
+    BOOL valueRangeChanged = (self.minimumValue != previousMinimumValue || self.maximumValue != previousMaximumValue);
+    if (valueRangeChanged) {
+        [self valueRangeDidChange];
+    }
+    return valueRangeChanged;
+}
+
+- (void)updateStreamingLineLayersForPlotIndex:(NSInteger)plotIndex {
+    SFLineGraphStreamingPlot *streamingPlot = [SFLineGraphStreamingPlot new];
+    [self.plotView.layer addSublayer:streamingPlot.contentLayer];
+    _streamingPlots[@(plotIndex)] = streamingPlot;
+    
+    UIColor *color = [self colorForPlotIndex:plotIndex];
+    UIColor *fillColor = [self fillColorForPlotIndex:plotIndex];
+    SFGraphChartPlotBuffer *plotBuffer = self.plotBuffers[plotIndex];
+    NSInteger pointCount = plotBuffer.count;
+    for (NSInteger pointIndex = 0; pointIndex < pointCount; pointIndex++) {
+        [self.lineLayers[plotIndex] addObject:[NSMutableArray new]];
+        [streamingPlot.fillLayers addObject:[NSMutableArray new]];
+        if ([plotBuffer isUnsetAtIndex:pointIndex]) {
             continue;
         }
-        UIBezierPath *linePath = [UIBezierPath bezierPath];
         
-        if (positionOnXAxis != SFCGFloatInvalidValue) {
-            [linePath moveToPoint:CGPointMake(positionOnXAxis, positionOnYAxis.minimumValue)];
-            if ([fillPath isEmpty]) {
-                // Substract scalePixelAdjustment() to the first horizontal position of the fillPath so if fully covers the start of the x axis
-                [fillPath moveToPoint:CGPointMake(positionOnXAxis - scalePixelAdjustment(),
-                                                  CGRectGetHeight(self.plotView.frame) + scalePixelAdjustment())];
-                [fillPath addLineToPoint:CGPointMake(positionOnXAxis - scalePixelAdjustment(),
-                                                     positionOnYAxis.minimumValue)];
-            } else {
-                [fillPath addLineToPoint:CGPointMake(positionOnXAxis, positionOnYAxis.minimumValue)];
+        if (streamingPlot.lastValidSampleIndex != NSNotFound) {
+            CAShapeLayer *fillLayer = graphLineLayer();
+            fillLayer.fillColor = fillColor.CGColor;
+            fillLayer.strokeColor = nil;
+            [streamingPlot.contentLayer insertSublayer:fillLayer atIndex:0];
+            [streamingPlot.fillLayers[pointIndex - 1] addObject:fillLayer];
+            
+            CAShapeLayer *lineLayer = graphLineLayer();
+            lineLayer.strokeColor = color.CGColor;
+            lineLayer.lineWidth = 2.0;
+            if (pointIndex - streamingPlot.lastValidSampleIndex > 1) {
+                lineLayer.lineDashPattern = @[@12, @6];
             }
+            [streamingPlot.contentLayer addSublayer:lineLayer];
+            [self.lineLayers[plotIndex][pointIndex - 1] addObject:lineLayer];
         }
-        
-        positionOnXAxis = xAxisPoint(pointIndex, self.numberOfXAxisPoints, self.plotView.bounds.size.width);
-        positionOnYAxis = self.yAxisPoints[plotIndex][pointIndex];
-        
-        if (!previousPointExists) {
-            if (positionOnXAxis != SFCGFloatInvalidValue) {
-                previousPointExists = YES;
-            }
+        streamingPlot.lastValidSampleIndex = pointIndex;
+    }
+}
+
+- (void)layoutStreamingLineLayersForPlotIndex:(NSInteger)plotIndex {
+    SFLineGraphStreamingPlot *streamingPlot = _streamingPlots[@(plotIndex)];
+    streamingPlot.originSampleIndex = streamingPlot.firstSampleIndex;
+    
+    SFGraphChartPlotBuffer *plotBuffer = self.plotBuffers[plotIndex];
+    NSInteger previousPointIndex = NSNotFound;
+    NSInteger pointCount = plotBuffer.count;
+    for (NSInteger pointIndex = 0; pointIndex < pointCount; pointIndex++) {
+        if ([plotBuffer isUnsetAtIndex:pointIndex]) {
             continue;
         }
-        
-        [linePath addLineToPoint:CGPointMake(positionOnXAxis, positionOnYAxis.minimumValue)];
-        // Add scalePixelAdjustment() to the last vertical position of the fillPath so if fully covers the end of the x axis
-        [fillPath addLineToPoint:CGPointMake(positionOnXAxis + ( (pointIndex == (numberOfPoints - 1)) ? scalePixelAdjustment() : 0 ),
-                                             positionOnYAxis.minimumValue)];
-        
-        CAShapeLayer *lineLayer = self.lineLayers[plotIndex][pointIndex - 1][0];
-        lineLayer.path = linePath.CGPath;
+        if (pointIndex > 0 && self.lineLayers[plotIndex][pointIndex - 1].count > 0) {
+            if (previousPointIndex != NSNotFound) {
+                [self layoutStreamingSegmentFromPointIndex:previousPointIndex toPointIndex:pointIndex plotIndex:plotIndex];
+            } else {
+                // The segment starts at an evicted value
+                self.lineLayers[plotIndex][pointIndex - 1].firstObject.path = nil;
+                streamingPlot.fillLayers[pointIndex - 1].firstObject.path = nil;
+            }
+        }
+        previousPointIndex = pointIndex;
     }
+    [self layoutStreamingContentLayerForPlotIndex:plotIndex];
+}
+
+- (void)layoutStreamingSegmentFromPointIndex:(NSInteger)fromPointIndex toPointIndex:(NSInteger)toPointIndex plotIndex:(NSInteger)plotIndex {
+    SFLineGraphStreamingPlot *streamingPlot = _streamingPlots[@(plotIndex)];
+    SFGraphChartPlotBuffer *plotBuffer = self.plotBuffers[plotIndex];
     
-    [fillPath addLineToPoint:CGPointMake(positionOnXAxis + scalePixelAdjustment(),
-                                         CGRectGetHeight(self.plotView.frame) + scalePixelAdjustment())];
-        
-    fillLayer.path = fillPath.CGPath;
+    // Content layer coordinates are relative to the origin sample, so they do not change as the plot scrolls
+    CGFloat sampleWidth = [self streamingSampleWidth];
+    NSInteger originPointIndex = streamingPlot.originSampleIndex - streamingPlot.firstSampleIndex;
+    CGPoint fromPoint = CGPointMake((fromPointIndex - originPointIndex) * sampleWidth, plotBuffer.canvasMinimumValues[fromPointIndex]);
+    CGPoint toPoint = CGPointMake((toPointIndex - originPointIndex) * sampleWidth, plotBuffer.canvasMinimumValues[toPointIndex]);
+    CGFloat bottom = CGRectGetHeight(self.plotView.bounds) + scalePixelAdjustment();
+    
+    UIBezierPath *linePath = [UIBezierPath bezierPath];
+    [linePath moveToPoint:fromPoint];
+    [linePath addLineToPoint:toPoint];
+    self.lineLayers[plotIndex][toPointIndex - 1].firstObject.path = linePath.CGPath;
+    
+    UIBezierPath *fillPath = [UIBezierPath bezierPath];
+    [fillPath moveToPoint:CGPointMake(fromPoint.x, bottom)];
+    [fillPath addLineToPoint:fromPoint];
+    [fillPath addLineToPoint:toPoint];
+    [fillPath addLineToPoint:CGPointMake(toPoint.x, bottom)];
+    [fillPath closePath];
+    streamingPlot.fillLayers[toPointIndex - 1].firstObject.path = fillPath.CGPath;
+}
+
+- (void)layoutStreamingContentLayerForPlotIndex:(NSInteger)plotIndex {
+    SFLineGraphStreamingPlot *streamingPlot = _streamingPlots[@(plotIndex)];
+    CGRect bounds = self.plotView.bounds;
+    CGFloat translation = (streamingPlot.firstSampleIndex - streamingPlot.originSampleIndex) * [self streamingSampleWidth];
+    streamingPlot.contentLayer.frame = CGRectOffset(bounds, -translation, 0);
 }
 
 #pragma mark - Graph Calculations
@@ -243,33 +878,23 @@ const CGFloat FillColorAlpha = 0.4;
     double value = [super scrubbingLabelValueForCanvasXPosition:xPosition plotIndex:plotIndex];
     
     if (value == SFDoubleInvalidValue) {
-    CGFloat viewWidth = self.plotView.bounds.size.width;
-    NSInteger numberOfXAxisPoints = self.numberOfXAxisPoints;
-        NSInteger pointIndex = 0;
-        for (pointIndex = 0; pointIndex < (numberOfXAxisPoints - 1); pointIndex++) {
-            CGFloat xAxisPointValue = xAxisPoint(pointIndex, numberOfXAxisPoints, viewWidth);
-            if (xAxisPointValue > xPosition) {
-                break;
-            }
-        }
+        NSInteger numberOfXPositions = [self numberOfCanvasXPositionsForPlotIndex:plotIndex];
+        NSInteger pointIndex = MIN([self pointIndexAfterXPosition:xPosition plotIndex:plotIndex], MAX(0, numberOfXPositions - 1));
         
         NSInteger previousValidIndex = [self previousValidPointIndexForPointIndex:pointIndex plotIndex:plotIndex];
         NSInteger nextValidIndex = [self nextValidPointIndexForPointIndex:pointIndex plotIndex:plotIndex];
         
-        CGFloat x1 = xAxisPoint(previousValidIndex, numberOfXAxisPoints, viewWidth);
-        CGFloat x2 = xAxisPoint(nextValidIndex, numberOfXAxisPoints, viewWidth);
+        const CGFloat *xPositions = [self canvasXPositionsForPlotIndex:plotIndex];
+        CGFloat x1 = xPositions[previousValidIndex];
+        CGFloat x2 = xPositions[nextValidIndex];
         
-        double y1 = self.dataPoints[plotIndex][previousValidIndex].minimumValue;
-        double y2 = self.dataPoints[plotIndex][nextValidIndex].minimumValue;
+        double y1 = self.plotBuffers[plotIndex].minimumValues[previousValidIndex];
+        double y2 = self.plotBuffers[plotIndex].minimumValues[nextValidIndex];
         
         if (y1 == SFDoubleInvalidValue || y2 == SFDoubleInvalidValue) {
             return SFDoubleInvalidValue;
         }
-
-        double slope = (y2 - y1)/(x2 - x1);
-        
-        //  (y2 - y3)/(x2 - x3) = m
-        value = y2 - (slope * (x2 - xPosition));
+        value = SFChartGeometryInterpolatedY(x1, y1, x2, y2, xPosition);
     }
     return value;
 }
@@ -281,51 +906,46 @@ const CGFloat FillColorAlpha = 0.4;
     
     double canvasYPosition = 0;
     if (nextValidIndex == previousValidIndex) {
-        canvasYPosition = self.yAxisPoints[plotIndex][previousValidIndex].minimumValue;
+        canvasYPosition = self.plotBuffers[plotIndex].canvasMinimumValues[previousValidIndex];
     } else {
-    CGFloat viewWidth = self.plotView.bounds.size.width;
-    NSInteger numberOfXAxisPoints = self.numberOfXAxisPoints;
-
-    CGFloat x1 = xAxisPoint(previousValidIndex, numberOfXAxisPoints, viewWidth);
-    CGFloat x2 = xAxisPoint(nextValidIndex, numberOfXAxisPoints, viewWidth);
-    
-        double y1 = self.yAxisPoints[plotIndex][previousValidIndex].minimumValue;
-        double y2 = self.yAxisPoints[plotIndex][nextValidIndex].minimumValue;
+        const CGFloat *xPositions = [self canvasXPositionsForPlotIndex:plotIndex];
+        CGFloat x1 = xPositions[previousValidIndex];
+        CGFloat x2 = xPositions[nextValidIndex];
         
-        double slope = (y2 - y1)/(x2 - x1);
-    
-    //  (y2 - y3)/(x2 - x3) = m
-        canvasYPosition = y2 - (slope * (x2 - xPosition));
+        double y1 = self.plotBuffers[plotIndex].canvasMinimumValues[previousValidIndex];
+        double y2 = self.plotBuffers[plotIndex].canvasMinimumValues[nextValidIndex];
+        canvasYPosition = SFChartGeometryInterpolatedY(x1, y1, x2, y2, xPosition);
     }
     return canvasYPosition;
 }
 
+- (NSRange)culledXAxisPointRangeForPlotIndex:(NSInteger)plotIndex {
+    NSRange culledRange = [super culledXAxisPointRangeForPlotIndex:plotIndex];
+    if (culledRange.length == 0 || culledRange.length == self.plotBuffers[plotIndex].count) {
+        return culledRange;
+    }
+    // Extend to the valid points around the culled range so the segments crossing its edges are drawn
+    NSInteger startIndex = [self previousValidPointIndexForPointIndex:culledRange.location + 1 plotIndex:plotIndex];
+    NSInteger endIndex = [self nextValidPointIndexForPointIndex:NSMaxRange(culledRange) - 1 plotIndex:plotIndex] + 1;
+    return NSMakeRange(startIndex, endIndex - startIndex);
+}
+
 - (NSInteger)nextValidPointIndexForPointIndex:(NSInteger)pointIndex plotIndex:(NSInteger)plotIndex {
-    NSUInteger validPosition = pointIndex;
-    
-    NSUInteger pointCountMinusOne = (self.dataPoints[plotIndex].count - 1);
-    while (validPosition < pointCountMinusOne) {
-        if (self.dataPoints[plotIndex][validPosition].minimumValue != SFDoubleInvalidValue) {
-            break;
-        }
-        validPosition++;
+    NSInteger lastPointIndex = self.plotBuffers[plotIndex].count - 1;
+    if (pointIndex >= lastPointIndex) {
+        return pointIndex;
     }
-    
-    return validPosition;
+    // Falls back to the last point when the rest of the plot is unset
+    NSInteger validIndex = [self.plotBuffers[plotIndex] indexOfValidValueAtOrAfterIndex:MAX(pointIndex, 0)];
+    return MIN(validIndex, lastPointIndex);
 }
 
 - (NSInteger)previousValidPointIndexForPointIndex:(NSInteger)pointIndex plotIndex:(NSInteger)plotIndex {
-    NSInteger validPosition = pointIndex - 1;
-    if (validPosition < 0) {
-        validPosition = 0;
-    }
-    while (validPosition > 0) {
-        if (self.dataPoints[plotIndex][validPosition].minimumValue != SFDoubleInvalidValue) {
-            break;
-        }
-        validPosition--;
-    }
-    return validPosition;
+    SFGraphChartPlotBuffer *plotBuffer = self.plotBuffers[plotIndex];
+    NSInteger startIndex = MIN(MAX(pointIndex - 1, 0), plotBuffer.count - 1);
+    // Falls back to the first point when the start of the plot is unset
+    NSInteger validIndex = [plotBuffer indexOfValidValueAtOrBeforeIndex:startIndex];
+    return (validIndex == NSNotFound) ? 0 : validIndex;
 }
 
 #pragma mark - Animations
@@ -342,7 +962,35 @@ const CGFloat FillColorAlpha = 0.4;
 }
 
 - (void)animateLayersSequentiallyWithDuration:(NSTimeInterval)duration plotIndex:(NSInteger)plotIndex {
-    [super animateLayersSequentiallyWithDuration:duration plotIndex:plotIndex];
+    if (_streamingWindowSize > 0) {
+        [super animateLayersSequentiallyWithDuration:duration plotIndex:plotIndex];
+    } else {
+        // Sweep the solid and dashed paths in together from left to right, however the length of the
+        // plot is split between them; the sweep follows the laid out paths
+        [self layoutIfNeeded];
+        NSArray<CAShapeLayer *> *lineLayers = self.lineLayers[plotIndex].firstObject;
+        CGRect sweptRect = CGRectNull;
+        for (CAShapeLayer *lineLayer in lineLayers) {
+            if (lineLayer.path) {
+                sweptRect = CGRectUnion(sweptRect, CGPathGetPathBoundingBox(lineLayer.path));
+            }
+        }
+        for (CAShapeLayer *lineLayer in lineLayers) {
+            CAAnimation *animation = nil;
+            if (lineLayer.path && !CGRectIsNull(sweptRect)) {
+                animation = sweepingStrokeEndAnimation(lineLayer.path, CGRectGetMinX(sweptRect), CGRectGetMaxX(sweptRect), duration);
+            }
+            if (animation) {
+                [lineLayer addAnimation:animation forKey:@"strokeEnd"];
+            } else {
+                [self animateLayer:lineLayer
+                           keyPath:@"strokeEnd"
+                          duration:duration
+                        startDelay:0
+                    timingFunction:[CAMediaTimingFunction functionWithName:kCAMediaTimingFunctionLinear]];
+            }
+        }
+    }
     // animate all fill layers at once at the beginning
     if (plotIndex == 0) {
     [_fillLayers enumerateKeysAndObjectsUsingBlock:^(id key, CAShapeLayer *layer, BOOL *stop) {
@@ -0,0 +1,96 @@
+//
+//  SFTimeSeriesGraphChartView.h
+//  SFKit
+//
+//  Created by David Moore on 10/17/26.
+//  Copyright © 2026 Moore Development. All rights reserved.
+//
+
+@import UIKit;
+#import <SFKit/SFLineGraphChartView.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class SFTimeSeriesGraphChartView;
+
+/**
+ An object that adopts the `SFTimeSeriesGraphChartViewDataSource` protocol is responsible for
+ providing the x values, such as timestamps, of the value ranges plotted by an
+ `SFTimeSeriesGraphChartView` object, in addition to the value ranges themselves.
+ */
+SF_AVAILABLE_DECL
+@protocol SFTimeSeriesGraphChartViewDataSource <SFValueRangeGraphChartViewDataSource>
+
+@required
+
+/**
+ Asks the data source for the x value of the specified point index for the specified plot.
+ 
+ The x values of a plot must be in ascending order, and must be provided for unset value ranges too.
+ 
+ @param graphChartView      The graph chart view that is asking for the x value.
+ @param pointIndex          An index number identifying the point in the graph chart view.
+ @param plotIndex           An index number identifying the plot in the graph chart view. This index
+                                is 0 in a single-plot graph chart view.
+ 
+ @return The x value of the point specified by `pointIndex` in the plot specified by `plotIndex`.
+ */
+- (double)graphChartView:(SFTimeSeriesGraphChartView *)graphChartView xValueForPointIndex:(NSInteger)pointIndex plotIndex:(NSInteger)plotIndex;
+
+@optional
+
+/**
+ Asks the data source to fill the specified buffer with the x values of the points in the specified
+ range of point indexes for the specified plot.
+ 
+ Implement this method when your x values are already stored in contiguous arrays. The graph chart
+ view then uses it instead of `graphChartView:xValueForPointIndex:plotIndex:`.
+ 
+ @param graphChartView      The graph chart view that is asking for the x values.
+ @param xValues             A buffer with room for `range.length` values, to be filled with the x
+                                values of the points starting at `range.location`.
+ @param range               The range of point indexes whose x values are requested.
+ @param plotIndex           An index number identifying the plot in the graph chart view. This index
+                                is 0 in a single-plot graph chart view.
+ */
+- (void)graphChartView:(SFTimeSeriesGraphChartView *)graphChartView getXValues:(double *)xValues range:(NSRange)range plotIndex:(NSInteger)plotIndex;
+
+@end
+
+
+/**
+ The `SFTimeSeriesGraphChartView` class presents the data provided by an object conforming to the
+ `SFTimeSeriesGraphChartViewDataSource` protocol as a line graph whose points are positioned by their
+ x values rather than evenly spaced by their point indexes, which suits irregularly sampled data.
+ 
+ The x-axis spans from the lowest to the highest x value of every plot, and the x values are mapped
+ linearly to the plot area. Scrubbing searches the sorted x values of the scrubbed plot. The x-axis
+ titles and vertical reference lines remain evenly spaced across the plot area.
+ 
+ Streaming, downsampling and the `visibleXAxisRange` property do not apply to time series graph chart
+ views.
+ */
+SF_CLASS_AVAILABLE
+@interface SFTimeSeriesGraphChartView : SFLineGraphChartView
+
+/**
+ The data source responsible for providing the data required to populate the graph chart view.
+ 
+ See the `SFTimeSeriesGraphChartViewDataSource` protocol.
+ */
+@property (nonatomic, weak) id <SFTimeSeriesGraphChartViewDataSource> dataSource;
+
+/**
+ The largest x-value interval between two consecutive points that is drawn as a solid line.
+ 
+ Consecutive points further apart than this interval are joined by a dashed line, marking a gap in
+ the data. When this property is 0, unset value ranges mark the gaps instead, as in a line graph.
+ 
+ The default value of this property is 0.
+ */
+@property (nonatomic) double maximumXInterval;
+
+@end
+
+NS_ASSUME_NONNULL_END
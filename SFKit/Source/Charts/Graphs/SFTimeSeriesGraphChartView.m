@@ -0,0 +1,193 @@
+//
+//  SFTimeSeriesGraphChartView.m
+//  SFKit
+//
+//  Created by David Moore on 10/17/26.
+//  Copyright © 2026 Moore Development. All rights reserved.
+//
+
+#import "SFTimeSeriesGraphChartView.h"
+
+#import "SFGraphChartView_Internal.h"
+
+
+@implementation SFTimeSeriesGraphChartView {
+    NSMutableArray<NSMutableData *> *_canvasXPositions; // CGFloat position of every point of each plot
+    CGFloat _canvasXPositionsWidth;
+    double _minimumXValue;
+    double _maximumXValue;
+    BOOL _hasCanvasXPositions;
+}
+
+@dynamic dataSource;
+
+#pragma mark - Init
+
+- (void)sharedInit {
+    [super sharedInit];
+    _canvasXPositions = [NSMutableArray new];
+    _minimumXValue = SFDoubleInvalidValue;
+    _maximumXValue = -SFDoubleInvalidValue;
+}
+
+- (void)setMaximumXInterval:(double)maximumXInterval {
+    _maximumXInterval = maximumXInterval;
+    [self invalidateTiles];
+    [self invalidateLayout:SFGraphChartViewInvalidationPlotGeometry];
+}
+
+- (void)setStreamingWindowSize:(NSInteger)streamingWindowSize {
+    if (streamingWindowSize > 0) {
+        @throw [NSException exceptionWithName:NSInternalInconsistencyException
+                                       reason:@"Streaming is not available in time series graph chart views"
+                                     userInfo:nil];
+    }
+    [super setStreamingWindowSize:streamingWindowSize];
+}
+
+#pragma mark - Data
+
+- (void)fillPlotBuffer:(SFGraphChartPlotBuffer *)plotBuffer forPlotIndex:(NSInteger)plotIndex {
+    [super fillPlotBuffer:plotBuffer forPlotIndex:plotIndex];
+
+    // Padding values repeat the last x value, so they are added again once the x values are stored
+    [plotBuffer removePaddingValues];
+    [self obtainXValuesInRange:NSMakeRange(0, plotBuffer.count) plotIndex:plotIndex inPlotBuffer:plotBuffer];
+    [plotBuffer padWithUnsetValuesToCount:self.numberOfXAxisPoints];
+    _hasCanvasXPositions = NO;
+}
+
+- (void)replaceDataPointsAtIndexes:(NSIndexSet *)indexes plotIndex:(NSInteger)plotIndex inPlotBuffer:(SFGraphChartPlotBuffer *)plotBuffer {
+    [super replaceDataPointsAtIndexes:indexes plotIndex:plotIndex inPlotBuffer:plotBuffer];
+    [indexes enumerateRangesUsingBlock:^(NSRange range, BOOL *stop) {
+        [self obtainXValuesInRange:range plotIndex:plotIndex inPlotBuffer:plotBuffer];
+    }];
+    _hasCanvasXPositions = NO;
+}
+
+- (void)obtainXValuesInRange:(NSRange)range plotIndex:(NSInteger)plotIndex inPlotBuffer:(SFGraphChartPlotBuffer *)plotBuffer {
+    id<SFTimeSeriesGraphChartViewDataSource> dataSource = self.dataSource;
+    BOOL fillsXValues = [dataSource respondsToSelector:@selector(graphChartView:getXValues:range:plotIndex:)];
+    [plotBuffer replaceXValuesInRange:range fillBlock:^(double *xValues) {
+        if (fillsXValues) {
+            [dataSource graphChartView:self getXValues:xValues range:range plotIndex:plotIndex];
+        } else {
+            for (NSUInteger index = 0; index < range.length; index++) {
+                xValues[index] = [dataSource graphChartView:self xValueForPointIndex:range.location + index plotIndex:plotIndex];
+            }
+        }
+    }];
+
+    // Scrubbing relies on binary searches, so the obtained x values must be sorted along with their neighbors
+    const double *xValues = plotBuffer.xValues;
+    NSInteger startIndex = MAX((NSInteger)range.location - 1, 0);
+    NSInteger endIndex = MIN((NSInteger)NSMaxRange(range) + 1, plotBuffer.count);
+    for (NSInteger index = startIndex + 1; index < endIndex; index++) {
+        if (!(xValues[index] >= xValues[index - 1])) {
+            @throw [NSException exceptionWithName:NSInternalInconsistencyException
+                                           reason:[NSString stringWithFormat:@"The x values of plot %ld are not in ascending order at point index %ld", (long)plotIndex, (long)index]
+                                         userInfo:nil];
+        }
+    }
+}
+
+- (void)updateLayersForReloadedData {
+    _hasCanvasXPositions = NO;
+    [super updateLayersForReloadedData];
+}
+
+#pragma mark - Layout
+
+- (NSRange)visibleXAxisPointRangeForNumberOfXAxisPoints:(NSInteger)numberOfXAxisPoints {
+    // Points are positioned by their x values, so every point is visible
+    return NSMakeRange(0, numberOfXAxisPoints);
+}
+
+- (NSInteger)downsamplingBucketCountForPlotIndex:(NSInteger)plotIndex {
+    // Point index buckets do not follow the pixel columns once the points are irregularly spaced
+    return 0;
+}
+
+- (const CGFloat *)canvasXPositionsForPlotIndex:(NSInteger)plotIndex {
+    CGFloat canvasWidth = self.plotView.bounds.size.width;
+    if (!_hasCanvasXPositions || canvasWidth != _canvasXPositionsWidth || _canvasXPositions.count != self.plotBuffers.count) {
+        [self updateCanvasXPositionsWithCanvasWidth:canvasWidth];
+    }
+    return (plotIndex < _canvasXPositions.count) ? _canvasXPositions[plotIndex].bytes : NULL;
+}
+
+- (NSInteger)numberOfCanvasXPositionsForPlotIndex:(NSInteger)plotIndex {
+    return (plotIndex < self.plotBuffers.count) ? self.plotBuffers[plotIndex].count : 0;
+}
+
+- (void)updateCanvasXPositionsWithCanvasWidth:(CGFloat)canvasWidth {
+    // The x-axis spans every plot, whose x values are sorted
+    NSArray<SFGraphChartPlotBuffer *> *plotBuffers = self.plotBuffers;
+    double minimumXValue = SFDoubleInvalidValue;
+    double maximumXValue = -SFDoubleInvalidValue;
+    for (SFGraphChartPlotBuffer *plotBuffer in plotBuffers) {
+        if (plotBuffer.count > 0 && plotBuffer.xValues) {
+            minimumXValue = MIN(minimumXValue, plotBuffer.xValues[0]);
+            maximumXValue = MAX(maximumXValue, plotBuffer.xValues[plotBuffer.count - 1]);
+        }
+    }
+
+    [_canvasXPositions removeAllObjects];
+    for (SFGraphChartPlotBuffer *plotBuffer in plotBuffers) {
+        NSInteger count = plotBuffer.xValues ? plotBuffer.count : 0;
+        NSMutableData *positionData = [NSMutableData dataWithLength:MAX(count, 1) * sizeof(CGFloat)];
+        CGFloat *xPositions = positionData.mutableBytes;
+#if CGFLOAT_IS_DOUBLE
+        SFGraphKernelMapToCanvasX(plotBuffer.xValues, xPositions, count, minimumXValue, maximumXValue, canvasWidth);
+        SFGraphKernelFloor(xPositions, count);
+#else
+        NSMutableData *canvasXValueData = [NSMutableData dataWithLength:MAX(count, 1) * sizeof(double)];
+        double *canvasXValues = canvasXValueData.mutableBytes;
+        SFGraphKernelMapToCanvasX(plotBuffer.xValues, canvasXValues, count, minimumXValue, maximumXValue, canvasWidth);
+        SFGraphKernelFloor(canvasXValues, count);
+        for (NSInteger index = 0; index < count; index++) {
+            xPositions[index] = canvasXValues[index];
+        }
+#endif
+        [_canvasXPositions addObject:positionData];
+    }
+    if (minimumXValue != _minimumXValue || maximumXValue != _maximumXValue) {
+        // The plots which were not updated are positioned against the previous x-axis span
+        _minimumXValue = minimumXValue;
+        _maximumXValue = maximumXValue;
+        [self invalidateLayout:SFGraphChartViewInvalidationPlotGeometry];
+    }
+    _canvasXPositionsWidth = canvasWidth;
+    _hasCanvasXPositions = YES;
+}
+
+- (NSInteger)scrubbedPointIndexForPlotIndex:(NSInteger)plotIndex xPosition:(CGFloat)xPosition scrubbedPointIndex:(NSInteger)scrubbedPointIndex {
+    // Each plot has its own x values, so its point is searched for in its own positions
+    if ([self numberOfCanvasXPositionsForPlotIndex:plotIndex] == 0) {
+        return NSNotFound;
+    }
+    return [self pointIndexForXPosition:xPosition plotIndex:plotIndex];
+}
+
+- (const CGFloat *)tileXPositionsForPlotIndex:(NSInteger)plotIndex {
+    // The x-axis positions do not depend on the visible range
+    return [self canvasXPositionsForPlotIndex:plotIndex];
+}
+
+- (CGFloat)maximumSolidSegmentWidthForPlotIndex:(NSInteger)plotIndex {
+    if (_maximumXInterval <= 0 || _maximumXValue <= _minimumXValue) {
+        return [super maximumSolidSegmentWidthForPlotIndex:plotIndex];
+    }
+    // The x values are mapped to floored positions, so the interval is matched within a point
+    return _maximumXInterval * self.plotView.bounds.size.width / (_maximumXValue - _minimumXValue);
+}
+
+- (BOOL)drawsGapFromPointIndex:(NSInteger)previousPointIndex toPointIndex:(NSInteger)pointIndex plotIndex:(NSInteger)plotIndex followingUnsetValues:(BOOL)followsUnsetValues {
+    if (_maximumXInterval <= 0) {
+        return [super drawsGapFromPointIndex:previousPointIndex toPointIndex:pointIndex plotIndex:plotIndex followingUnsetValues:followsUnsetValues];
+    }
+    const double *xValues = self.plotBuffers[plotIndex].xValues;
+    return (xValues[pointIndex] - xValues[previousPointIndex] > _maximumXInterval);
+}
+
+@end
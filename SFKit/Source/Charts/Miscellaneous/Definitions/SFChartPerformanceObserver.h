@@ -0,0 +1,90 @@
+//
+//  SFChartPerformanceObserver.h
+//  SFKit
+//
+//  Created by David Moore on 10/17/26.
+//  Copyright © 2026 Moore Development. All rights reserved.
+//
+
+@import UIKit;
+#import <SFKit/SFDefines.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ The phases of the chart pipeline, in the order they run.
+
+ - SFChartPhaseDataSource: Obtaining the values from the data source.
+ - SFChartPhaseExtrema: Resolving the minimum and maximum values of the y-axis.
+ - SFChartPhaseNormalization: Mapping the values to the canvas.
+ - SFChartPhaseLayerUpdate: Creating, reusing and configuring the layers of the chart.
+ - SFChartPhaseLayout: Positioning the layers and building their paths.
+ - SFChartPhaseCommit: The Core Animation commit which follows the layout of a batch update. It includes
+ the changes of every other view committed in the same transaction. Layout passes run within a commit
+ and cannot bracket it, so the commits which follow them are not measured.
+ */
+typedef NS_ENUM(NSInteger, SFChartPhase) {
+    SFChartPhaseDataSource,
+    SFChartPhaseExtrema,
+    SFChartPhaseNormalization,
+    SFChartPhaseLayerUpdate,
+    SFChartPhaseLayout,
+    SFChartPhaseCommit
+} SF_ENUM_AVAILABLE;
+
+/**
+ The `SFChartPhaseMetrics` class describes one run of a phase of the chart pipeline.
+ */
+SF_CLASS_AVAILABLE
+@interface SFChartPhaseMetrics : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
++ (instancetype)new NS_UNAVAILABLE;
+
+/**
+ The phase that ran.
+ */
+@property (nonatomic, readonly) SFChartPhase phase;
+
+/**
+ The time it took, in seconds.
+ */
+@property (nonatomic, readonly) NSTimeInterval duration;
+
+/**
+ The number of points, or pie segments, charted by the view when the phase ended.
+ */
+@property (nonatomic, readonly) NSInteger numberOfPoints;
+
+/**
+ The number of layers the chart allocated during the phase. Layers reused from an earlier phase are
+ not counted.
+ */
+@property (nonatomic, readonly) NSInteger numberOfAllocatedLayers;
+
+@end
+
+
+/**
+ An object that adopts the `SFChartPerformanceObserver` protocol is told how long each phase of a
+ chart took, for example to forward the durations to a telemetry service.
+
+ The phases are also logged as `os_signpost` intervals in the "ChartPipeline" category of the SFKit
+ subsystem on iOS 12 and later, so they appear in Instruments whether or not an observer is set.
+ */
+SF_AVAILABLE_DECL
+@protocol SFChartPerformanceObserver <NSObject>
+
+/**
+ Tells the observer that a phase of the chart pipeline finished. This method is called on the main
+ thread, right after the phase.
+
+ @param chartView   The chart view that ran the phase.
+ @param metrics     The metrics of the phase.
+ */
+- (void)chartView:(UIView *)chartView didFinishPhaseWithMetrics:(SFChartPhaseMetrics *)metrics;
+
+@end
+
+NS_ASSUME_NONNULL_END
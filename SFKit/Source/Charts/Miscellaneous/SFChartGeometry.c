@@ -0,0 +1,138 @@
+//
+//  SFChartGeometry.c
+//  SFKit
+//
+//  Created by David Moore on 10/17/26.
+//  Copyright © 2026 Moore Development. All rights reserved.
+//
+
+#include "SFChartGeometry.h"
+
+#include <math.h>
+
+// Labels are rotated in steps of a hundredth of a radian while they intersect
+static const double SFChartGeometryPieLabelShiftStep = 0.01;
+
+static const double SFChartGeometryTwoPi = 6.28318530717958647693;
+
+// MARK: - Graphs
+
+double SFChartGeometryXAxisPoint(long pointIndex, long numberOfXAxisPoints, double canvasWidth) {
+    long numberOfIntervals = (numberOfXAxisPoints - 1 > 1) ? numberOfXAxisPoints - 1 : 1;
+    return floor((canvasWidth / numberOfIntervals) * pointIndex);
+}
+
+void SFChartGeometryXAxisPoints(double *positions, long count, long firstVisiblePointIndex,
+                                long numberOfVisiblePoints, double canvasWidth) {
+    for (long pointIndex = 0; pointIndex < count; pointIndex++) {
+        positions[pointIndex] = SFChartGeometryXAxisPoint(pointIndex - firstVisiblePointIndex, numberOfVisiblePoints, canvasWidth);
+    }
+}
+
+double SFChartGeometryXOffsetForPlotIndex(long plotIndex, long numberOfPlots, double plotWidth) {
+    if (numberOfPlots % 2 == 0) {
+        // Even
+        return (plotIndex - numberOfPlots / 2 + 0.5) * plotWidth;
+    }
+    // Odd
+    return (plotIndex - numberOfPlots / 2) * plotWidth;
+}
+
+double SFChartGeometryNormalizedCanvasValue(double value, double minimumValue, double maximumValue, double canvasHeight) {
+    if (minimumValue == maximumValue) {
+        return canvasHeight / 2;
+    }
+    return canvasHeight - (value - minimumValue) / (maximumValue - minimumValue) * canvasHeight;
+}
+
+double SFChartGeometryInterpolatedY(double x1, double y1, double x2, double y2, double x) {
+    if (x1 == x2) {
+        return y2;
+    }
+    //  (y2 - y3)/(x2 - x3) = m
+    double slope = (y2 - y1) / (x2 - x1);
+    return y2 - (slope * (x2 - x));
+}
+
+// MARK: - Pie
+
+void SFChartGeometryPieSegmentAngles(const double *normalizedValues, double *angles, long count, int clockwise) {
+    double direction = clockwise ? 1 : -1;
+    double cumulativeValue = 0;
+    for (long index = 0; index < count; index++) {
+        double value = normalizedValues[index];
+        angles[index] = (value / 2 + cumulativeValue) * direction * SFChartGeometryTwoPi;
+        cumulativeValue += value;
+    }
+}
+
+SFChartGeometryPoint SFChartGeometryPieLabelCenter(double angle, double pieRadius, SFChartGeometrySize labelSize,
+                                                   SFChartGeometrySize boundsSize) {
+    double length = pieRadius + SFChartGeometryPieLabelOffset;
+    double cosine = cos(angle + SFChartGeometryPieOriginAngle);
+    double sine = sin(angle + SFChartGeometryPieOriginAngle);
+    SFChartGeometryPoint center;
+    center.x = cosine * length + boundsSize.width / 2 + cosine * labelSize.width / 2;
+    center.y = sine * length + boundsSize.height / 2 + sine * labelSize.height / 2;
+    return center;
+}
+
+static int SFChartGeometryLabelsIntersect(SFChartGeometryPoint center, SFChartGeometrySize size,
+                                          SFChartGeometryPoint otherCenter, SFChartGeometrySize otherSize) {
+    return (fabs(center.x - otherCenter.x) * 2 < size.width + otherSize.width
+            && fabs(center.y - otherCenter.y) * 2 < size.height + otherSize.height);
+}
+
+// Rotates the label at `index` away from the label at `fromIndex` if they intersect
+static int SFChartGeometryShiftPieLabel(double *angles, SFChartGeometryPoint *centers, const SFChartGeometrySize *labelSizes,
+                                        long index, long fromIndex, double direction, double pieRadius,
+                                        SFChartGeometrySize boundsSize) {
+    if (!SFChartGeometryLabelsIntersect(centers[fromIndex], labelSizes[fromIndex], centers[index], labelSizes[index])) {
+        return 0;
+    }
+    angles[index] += direction * SFChartGeometryPieLabelShiftStep;
+    centers[index] = SFChartGeometryPieLabelCenter(angles[index], pieRadius, labelSizes[index], boundsSize);
+    return 1;
+}
+
+void SFChartGeometryResolvePieLabelIntersections(double *angles, SFChartGeometryPoint *centers,
+                                                 const SFChartGeometrySize *labelSizes, long count,
+                                                 double pieRadius, SFChartGeometrySize boundsSize, int clockwise) {
+    if (count == 0) {
+        return;
+    }
+    double rotateDirection = clockwise ? 1 : -1;
+    int shiftClockwise = 0;
+
+    // The total rotation bounds the number of sweeps
+    double totalAngle = 0;
+    int intersections = 1;
+    while (intersections) {
+        intersections = 0;
+        shiftClockwise = !shiftClockwise;
+
+        if (shiftClockwise) {
+            if (count > 1) {
+                totalAngle += SFChartGeometryPieLabelShiftStep;
+                if (totalAngle >= SFChartGeometryTwoPi) {
+                    return;
+                }
+            }
+            for (long index = 0; index < count - 1; index++) {
+                intersections |= SFChartGeometryShiftPieLabel(angles, centers, labelSizes, index + 1, index,
+                                                              rotateDirection, pieRadius, boundsSize);
+            }
+        } else {
+            for (long index = count - 1; index > 0; index--) {
+                intersections |= SFChartGeometryShiftPieLabel(angles, centers, labelSizes, index - 1, index,
+                                                              -rotateDirection, pieRadius, boundsSize);
+            }
+        }
+
+        // Adjust space between last and first label
+        if (SFChartGeometryLabelsIntersect(centers[count - 1], labelSizes[count - 1], centers[0], labelSizes[0])) {
+            angles[0] += rotateDirection * SFChartGeometryPieLabelShiftStep;
+            angles[count - 1] -= rotateDirection * SFChartGeometryPieLabelShiftStep;
+        }
+    }
+}
@@ -0,0 +1,89 @@
+//
+//  SFChartGeometry.h
+//  SFKit
+//
+//  Created by David Moore on 10/17/26.
+//  Copyright © 2026 Moore Development. All rights reserved.
+//
+
+#ifndef SFChartGeometry_h
+#define SFChartGeometry_h
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ The geometry behind the graph and pie charts, free of UIKit and Core Graphics so it can be built and
+ benchmarked on any platform. Coordinates are doubles in the canvas space of the calling view, with
+ the origin at the top left. The chart views wrap these functions; they only depend on the C standard
+ library.
+ */
+
+typedef struct SFChartGeometryPoint {
+    double x;
+    double y;
+} SFChartGeometryPoint;
+
+typedef struct SFChartGeometrySize {
+    double width;
+    double height;
+} SFChartGeometrySize;
+
+// MARK: - Graphs
+
+/// Returns the canvas x-coordinate of an x-axis point, where the first and last points lie on the edges of the canvas.
+double SFChartGeometryXAxisPoint(long pointIndex, long numberOfXAxisPoints, double canvasWidth);
+
+/**
+ Writes the canvas x-coordinates of `count` x-axis points, when `numberOfVisiblePoints` points starting
+ at `firstVisiblePointIndex` span the canvas. Points outside of that range lie past the canvas edges.
+ */
+void SFChartGeometryXAxisPoints(double *positions, long count, long firstVisiblePointIndex,
+                                long numberOfVisiblePoints, double canvasWidth);
+
+/// Returns the horizontal offset of a plot, so that the points of every plot are centered around their x-axis point.
+double SFChartGeometryXOffsetForPlotIndex(long plotIndex, long numberOfPlots, double plotWidth);
+
+/// Maps a value to a canvas y-coordinate, or to half the canvas height if both limits are equal.
+double SFChartGeometryNormalizedCanvasValue(double value, double minimumValue, double maximumValue, double canvasHeight);
+
+/// Returns the y-coordinate at `x` on the line through two points, or `y2` if both points have the same x-coordinate.
+double SFChartGeometryInterpolatedY(double x1, double y1, double x2, double y2, double x);
+
+// MARK: - Pie
+
+/// The angle, in radians, at which the pie starts: straight up.
+#define SFChartGeometryPieOriginAngle (-1.57079632679489661923)
+
+/// The distance between a pie and the edge of its labels.
+#define SFChartGeometryPieLabelOffset 10.0
+
+/**
+ Writes the angle to the centre of each segment, measured from the pie origin. The values are the
+ fractions of the pie taken up by each segment. Angles are negative when the pie is drawn anticlockwise.
+ */
+void SFChartGeometryPieSegmentAngles(const double *normalizedValues, double *angles, long count, int clockwise);
+
+/**
+ Returns the centre of a label of size `labelSize` placed outside of a pie of radius `pieRadius` at
+ `angle`, in a view of size `boundsSize`. The label is pushed out by half its size, so that its edge
+ rather than its centre keeps the distance from the pie.
+ */
+SFChartGeometryPoint SFChartGeometryPieLabelCenter(double angle, double pieRadius, SFChartGeometrySize labelSize,
+                                                   SFChartGeometrySize boundsSize);
+
+/**
+ Rotates overlapping labels apart, alternating between a clockwise and an anticlockwise sweep until no
+ neighbouring labels intersect or the labels have been rotated a full turn. `angles` and `centers`
+ hold the angle and centre of each label and are updated in place.
+ */
+void SFChartGeometryResolvePieLabelIntersections(double *angles, SFChartGeometryPoint *centers,
+                                                 const SFChartGeometrySize *labelSizes, long count,
+                                                 double pieRadius, SFChartGeometrySize boundsSize, int clockwise);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SFChartGeometry_h */
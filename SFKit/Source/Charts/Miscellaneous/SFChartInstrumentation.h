@@ -0,0 +1,62 @@
+//
+//  SFChartInstrumentation.h
+//  SFKit
+//
+//  Created by David Moore on 10/17/26.
+//  Copyright © 2026 Moore Development. All rights reserved.
+//
+
+@import UIKit;
+#import <SFKit/SFDefines.h>
+#import <SFKit/SFChartPerformanceObserver.h>
+#import "SFHelpers_Private.h"
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+// A phase of the chart pipeline which has begun; ended by SFChartPhaseEnd()
+typedef struct SFChartPhaseInterval {
+    SFChartPhase phase;
+    CFTimeInterval startTime;
+    NSUInteger allocatedLayerCount;
+    uint64_t signpostIdentifier;
+} SFChartPhaseInterval;
+
+// Layers allocated by every chart so far; only accessed on the main thread
+SF_EXTERN NSUInteger SFChartAllocatedLayerCount;
+
+SF_INLINE void SFChartNoteAllocatedLayer(void) {
+    SFChartAllocatedLayerCount++;
+}
+
+/// Begins a phase interval for a chart view, emitting a signpost when they are enabled. Safe to call off the main thread.
+SF_EXTERN SFChartPhaseInterval SFChartPhaseBegin(UIView *chartView, SFChartPhase phase);
+
+/// Ends a phase interval, emitting a signpost with the counts and reporting the metrics to `observer`.
+SF_EXTERN void SFChartPhaseEnd(UIView *chartView, SFChartPhaseInterval interval, NSInteger numberOfPoints,
+                               id<SFChartPerformanceObserver> _Nullable observer);
+
+/**
+ Ends a phase interval which ran off the main thread, emitting a signpost with the counts. Observers
+ are only called on the main thread, so the returned metrics are reported with `SFChartPhaseReport()`
+ once back on it. No layer is allocated off the main thread.
+ */
+SF_EXTERN SFChartPhaseMetrics *SFChartPhaseEndOffMainThread(SFChartPhaseInterval interval, NSInteger numberOfPoints);
+
+/// Reports the metrics returned by `SFChartPhaseEndOffMainThread()` to `observer`. Must be called on the main thread.
+SF_EXTERN void SFChartPhaseReport(UIView *chartView, SFChartPhaseMetrics *metrics,
+                                  id<SFChartPerformanceObserver> _Nullable observer);
+
+/**
+ Measures the Core Animation commit at the end of the current run loop iteration as a
+ `SFChartPhaseCommit` phase. Nothing is measured unless there is an observer or signposts are enabled,
+ or while `*measuresCommit`, an instance variable of the chart view, is `YES`; it is set until the
+ commit has been measured, so only the first call per run loop iteration is measured.
+ 
+ Must not be called during a layout pass: layout runs within the commit, so the commit measured would
+ be the following one.
+ */
+SF_EXTERN void SFChartPhaseMeasureNextCommit(UIView *chartView, NSInteger numberOfPoints,
+                                             id<SFChartPerformanceObserver> _Nullable observer, BOOL *measuresCommit);
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,162 @@
+//
+//  SFChartInstrumentation.m
+//  SFKit
+//
+//  Created by David Moore on 10/17/26.
+//  Copyright © 2026 Moore Development. All rights reserved.
+//
+
+#import "SFChartInstrumentation.h"
+
+#import <objc/runtime.h>
+#import <os/signpost.h>
+@import QuartzCore;
+
+
+NSUInteger SFChartAllocatedLayerCount = 0;
+
+// Core Animation commits the transaction in a run loop observer of this order
+static const CFIndex SFChartCommitObserverOrder = 2000000;
+
+@interface SFChartPhaseMetrics ()
+
+- (instancetype)initWithPhase:(SFChartPhase)phase duration:(NSTimeInterval)duration numberOfPoints:(NSInteger)numberOfPoints numberOfAllocatedLayers:(NSInteger)numberOfAllocatedLayers NS_DESIGNATED_INITIALIZER;
+
+@end
+
+
+@implementation SFChartPhaseMetrics
+
+- (instancetype)initWithPhase:(SFChartPhase)phase duration:(NSTimeInterval)duration numberOfPoints:(NSInteger)numberOfPoints numberOfAllocatedLayers:(NSInteger)numberOfAllocatedLayers {
+    if (self = [super init]) {
+        _phase = phase;
+        _duration = duration;
+        _numberOfPoints = numberOfPoints;
+        _numberOfAllocatedLayers = numberOfAllocatedLayers;
+    }
+    return self;
+}
+
+- (NSString *)description {
+    return [NSString stringWithFormat:@"<%@: %p; phase = %ld; duration = %f; numberOfPoints = %ld; numberOfAllocatedLayers = %ld>",
+            self.class, self, (long)_phase, _duration, (long)_numberOfPoints, (long)_numberOfAllocatedLayers];
+}
+
+@end
+
+
+static os_log_t SFChartPipelineLog(void) API_AVAILABLE(ios(12.0)) {
+    static os_log_t log;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        log = os_log_create("ca.mooredev.SFKit", "ChartPipeline");
+    });
+    return log;
+}
+
+// Signpost names must be string literals, hence a case per phase
+#define SF_CHART_PHASE_SIGNPOST_CASES(emit) \
+    case SFChartPhaseDataSource: emit("DataSource"); break; \
+    case SFChartPhaseExtrema: emit("Extrema"); break; \
+    case SFChartPhaseNormalization: emit("Normalization"); break; \
+    case SFChartPhaseLayerUpdate: emit("LayerUpdate"); break; \
+    case SFChartPhaseLayout: emit("Layout"); break; \
+    case SFChartPhaseCommit: emit("Commit"); break;
+
+SFChartPhaseInterval SFChartPhaseBegin(UIView *chartView, SFChartPhase phase) {
+    // The layer count is only read on the main thread, where layers are allocated
+    NSUInteger allocatedLayerCount = [NSThread isMainThread] ? SFChartAllocatedLayerCount : 0;
+    SFChartPhaseInterval interval = {phase, CACurrentMediaTime(), allocatedLayerCount, 0};
+    if (@available(iOS 12.0, *)) {
+        os_log_t log = SFChartPipelineLog();
+        if (os_signpost_enabled(log)) {
+            os_signpost_id_t signpostIdentifier = os_signpost_id_generate(log);
+            interval.signpostIdentifier = signpostIdentifier;
+#define SF_EMIT_BEGIN(name) os_signpost_interval_begin(log, signpostIdentifier, name, "%{public}s %p", class_getName([chartView class]), chartView)
+            switch (phase) {
+                SF_CHART_PHASE_SIGNPOST_CASES(SF_EMIT_BEGIN)
+            }
+#undef SF_EMIT_BEGIN
+        }
+    }
+    return interval;
+}
+
+static void SFChartPhaseEmitEndSignpost(SFChartPhaseInterval interval, NSInteger numberOfPoints, NSInteger numberOfAllocatedLayers) {
+    if (@available(iOS 12.0, *)) {
+        os_log_t log = SFChartPipelineLog();
+        if (interval.signpostIdentifier != 0 && os_signpost_enabled(log)) {
+            os_signpost_id_t signpostIdentifier = interval.signpostIdentifier;
+#define SF_EMIT_END(name) os_signpost_interval_end(log, signpostIdentifier, name, "points=%ld layers=%ld", (long)numberOfPoints, (long)numberOfAllocatedLayers)
+            switch (interval.phase) {
+                SF_CHART_PHASE_SIGNPOST_CASES(SF_EMIT_END)
+            }
+#undef SF_EMIT_END
+        }
+    }
+}
+
+void SFChartPhaseEnd(UIView *chartView, SFChartPhaseInterval interval, NSInteger numberOfPoints,
+                     id<SFChartPerformanceObserver> observer) {
+    NSTimeInterval duration = CACurrentMediaTime() - interval.startTime;
+    NSInteger numberOfAllocatedLayers = SFChartAllocatedLayerCount - interval.allocatedLayerCount;
+    SFChartPhaseEmitEndSignpost(interval, numberOfPoints, numberOfAllocatedLayers);
+    if (observer) {
+        SFChartPhaseMetrics *metrics = [[SFChartPhaseMetrics alloc] initWithPhase:interval.phase
+                                                                        duration:duration
+                                                                  numberOfPoints:numberOfPoints
+                                                         numberOfAllocatedLayers:numberOfAllocatedLayers];
+        [observer chartView:chartView didFinishPhaseWithMetrics:metrics];
+    }
+}
+
+SFChartPhaseMetrics *SFChartPhaseEndOffMainThread(SFChartPhaseInterval interval, NSInteger numberOfPoints) {
+    NSTimeInterval duration = CACurrentMediaTime() - interval.startTime;
+    SFChartPhaseEmitEndSignpost(interval, numberOfPoints, 0);
+    return [[SFChartPhaseMetrics alloc] initWithPhase:interval.phase
+                                             duration:duration
+                                       numberOfPoints:numberOfPoints
+                              numberOfAllocatedLayers:0];
+}
+
+void SFChartPhaseReport(UIView *chartView, SFChartPhaseMetrics *metrics, id<SFChartPerformanceObserver> observer) {
+    [observer chartView:chartView didFinishPhaseWithMetrics:metrics];
+}
+
+void SFChartPhaseMeasureNextCommit(UIView *chartView, NSInteger numberOfPoints, id<SFChartPerformanceObserver> observer, BOOL *measuresCommit) {
+    if (*measuresCommit) {
+        return;
+    }
+    BOOL signpostsEnabled = NO;
+    if (@available(iOS 12.0, *)) {
+        signpostsEnabled = os_signpost_enabled(SFChartPipelineLog());
+    }
+    if (!observer && !signpostsEnabled) {
+        return;
+    }
+    *measuresCommit = YES;
+
+    // One-shot observers around the commit observer bracket the commit
+    __weak UIView *weakChartView = chartView;
+    __weak id<SFChartPerformanceObserver> weakObserver = observer;
+    __block SFChartPhaseInterval interval = {SFChartPhaseCommit, CACurrentMediaTime(), SFChartAllocatedLayerCount, 0};
+    CFRunLoopObserverRef beginObserver = CFRunLoopObserverCreateWithHandler(kCFAllocatorDefault, kCFRunLoopBeforeWaiting | kCFRunLoopExit, false, SFChartCommitObserverOrder - 1, ^(CFRunLoopObserverRef runLoopObserver, CFRunLoopActivity activity) {
+        UIView *strongChartView = weakChartView;
+        if (strongChartView) {
+            interval = SFChartPhaseBegin(strongChartView, SFChartPhaseCommit);
+        }
+    });
+    CFRunLoopObserverRef endObserver = CFRunLoopObserverCreateWithHandler(kCFAllocatorDefault, kCFRunLoopBeforeWaiting | kCFRunLoopExit, false, SFChartCommitObserverOrder + 1, ^(CFRunLoopObserverRef runLoopObserver, CFRunLoopActivity activity) {
+        UIView *strongChartView = weakChartView;
+        if (strongChartView) {
+            // The instance variable lives as long as the chart view
+            *measuresCommit = NO;
+            SFChartPhaseEnd(strongChartView, interval, numberOfPoints, weakObserver);
+        }
+    });
+    CFRunLoopRef runLoop = CFRunLoopGetMain();
+    CFRunLoopAddObserver(runLoop, beginObserver, kCFRunLoopCommonModes);
+    CFRunLoopAddObserver(runLoop, endObserver, kCFRunLoopCommonModes);
+    CFRelease(beginObserver);
+    CFRelease(endObserver);
+}
@@ -0,0 +1,37 @@
+//
+//  SFLeastRecentlyUsedCache.h
+//  SFKit
+//
+//  Created by David Moore on 10/17/26.
+//  Copyright © 2026 Moore Development. All rights reserved.
+//
+
+@import Foundation;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ A cache holding at most `capacity` objects, which evicts the least recently used object when an
+ object is added to a full cache. Looking up or adding an object makes it the most recently used one.
+ Both take O(1).
+ */
+@interface SFLeastRecentlyUsedCache<KeyType, ObjectType> : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+- (instancetype)initWithCapacity:(NSInteger)capacity NS_DESIGNATED_INITIALIZER;
+
+@property (nonatomic, readonly) NSInteger capacity;
+
+@property (nonatomic, readonly) NSInteger count;
+
+- (nullable ObjectType)objectForKey:(KeyType)key;
+
+- (void)setObject:(ObjectType)object forKey:(KeyType <NSCopying>)key;
+
+- (void)removeAllObjects;
+
+@end
+
+NS_ASSUME_NONNULL_END
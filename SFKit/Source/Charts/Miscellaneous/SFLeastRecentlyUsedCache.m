@@ -0,0 +1,123 @@
+//
+//  SFLeastRecentlyUsedCache.m
+//  SFKit
+//
+//  Created by David Moore on 10/17/26.
+//  Copyright © 2026 Moore Development. All rights reserved.
+//
+
+#import "SFLeastRecentlyUsedCache.h"
+
+
+// An entry of the cache, linked in order of use
+@interface SFLeastRecentlyUsedCacheEntry : NSObject {
+    @public
+    id _key;
+    id _object;
+    SFLeastRecentlyUsedCacheEntry *_next; // Less recently used
+    __unsafe_unretained SFLeastRecentlyUsedCacheEntry *_previous; // More recently used, retained through its _next
+}
+
+@end
+
+
+@implementation SFLeastRecentlyUsedCacheEntry
+
+@end
+
+
+@implementation SFLeastRecentlyUsedCache {
+    NSMutableDictionary<id, SFLeastRecentlyUsedCacheEntry *> *_entries;
+    SFLeastRecentlyUsedCacheEntry *_head; // Most recently used
+    __unsafe_unretained SFLeastRecentlyUsedCacheEntry *_tail; // Least recently used
+}
+
+- (instancetype)initWithCapacity:(NSInteger)capacity {
+    if (capacity <= 0) {
+        @throw [NSException exceptionWithName:NSInvalidArgumentException
+                                       reason:@"capacity must be greater than 0"
+                                     userInfo:nil];
+    }
+    if (self = [super init]) {
+        _capacity = capacity;
+        _entries = [[NSMutableDictionary alloc] initWithCapacity:capacity];
+    }
+    return self;
+}
+
+- (NSInteger)count {
+    return _entries.count;
+}
+
+- (id)objectForKey:(id)key {
+    SFLeastRecentlyUsedCacheEntry *entry = _entries[key];
+    if (!entry) {
+        return nil;
+    }
+    [self unlinkEntry:entry];
+    [self linkEntryAtHead:entry];
+    return entry->_object;
+}
+
+- (void)setObject:(id)object forKey:(id<NSCopying>)key {
+    SFLeastRecentlyUsedCacheEntry *entry = _entries[key];
+    if (entry) {
+        [self unlinkEntry:entry];
+    } else {
+        if ((NSInteger)_entries.count == _capacity) {
+            SFLeastRecentlyUsedCacheEntry *leastRecentlyUsedEntry = _tail;
+            [self unlinkEntry:leastRecentlyUsedEntry];
+            [_entries removeObjectForKey:leastRecentlyUsedEntry->_key];
+        }
+        entry = [SFLeastRecentlyUsedCacheEntry new];
+        entry->_key = [key copyWithZone:nil];
+        _entries[entry->_key] = entry;
+    }
+    entry->_object = object;
+    [self linkEntryAtHead:entry];
+}
+
+- (void)removeAllObjects {
+    // Unlinked front to back, so no entry outlives the one retaining it
+    while (_head) {
+        [self unlinkEntry:_head];
+    }
+    [_entries removeAllObjects];
+}
+
+- (void)dealloc {
+    [self removeAllObjects];
+}
+
+#pragma mark - Links
+
+- (void)linkEntryAtHead:(SFLeastRecentlyUsedCacheEntry *)entry {
+    entry->_previous = nil;
+    entry->_next = _head;
+    if (_head) {
+        _head->_previous = entry;
+    } else {
+        _tail = entry;
+    }
+    _head = entry;
+}
+
+- (void)unlinkEntry:(SFLeastRecentlyUsedCacheEntry *)entry {
+    // The entry is retained by the dictionary while it is relinked
+    SFLeastRecentlyUsedCacheEntry *next = entry->_next;
+    SFLeastRecentlyUsedCacheEntry *previous = entry->_previous;
+    if (previous) {
+        previous->_next = next;
+    } else {
+        _head = next;
+    }
+    if (next) {
+        next->_previous = previous;
+    } else {
+        _tail = previous;
+    }
+    entry->_next = nil;
+    entry->_previous = nil;
+}
+
+@end
@@ -34,10 +34,29 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
+@class SFLineGraphAccessibilityElement;
+
+/// Formats the label and value of an element the first time they are read, and again once the generation changes.
+@protocol SFLineGraphAccessibilityElementDataSource <NSObject>
+
+/// Changes whenever the points under the elements change, making their formatted strings stale.
+- (NSUInteger)accessibilityStringGenerationForLineGraphAccessibilityElement:(SFLineGraphAccessibilityElement *)element;
+
+- (nullable NSString *)accessibilityLabelForLineGraphAccessibilityElement:(SFLineGraphAccessibilityElement *)element;
+
+- (nullable NSString *)accessibilityValueForLineGraphAccessibilityElement:(SFLineGraphAccessibilityElement *)element;
+
+@end
+
 @interface SFLineGraphAccessibilityElement : UIAccessibilityElement
 
 - (nonnull instancetype)initWithAccessibilityContainer:(nonnull UIView *)container index:(NSInteger)index maxIndex:(NSInteger)maxIndex;
 
+@property (assign, nonatomic, readonly) NSInteger index;
+
+/// Asked for the accessibility label and value unless they are set explicitly.
+@property (weak, nonatomic, nullable) id<SFLineGraphAccessibilityElementDataSource> dataSource;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -33,23 +33,64 @@
 
 @interface SFLineGraphAccessibilityElement()
 
-@property (assign, nonatomic) NSInteger index;
+@property (assign, nonatomic, readwrite) NSInteger index;
 @property (assign, nonatomic) NSInteger maxIndex;
 
 @end
 
 
-@implementation SFLineGraphAccessibilityElement
+@implementation SFLineGraphAccessibilityElement {
+    BOOL _accessibilityLabelIsSet; // Set explicitly, so it is never formatted
+    BOOL _accessibilityValueIsSet;
+    NSUInteger _accessibilityLabelGeneration; // Generation the string was formatted for, or NSNotFound
+    NSUInteger _accessibilityValueGeneration;
+}
 
 - (nonnull instancetype)initWithAccessibilityContainer:(nonnull UIView *)container index:(NSInteger)index maxIndex:(NSInteger)maxIndex {
     self = [super initWithAccessibilityContainer:container];
     if (self) {
         self.index = index;
         self.maxIndex = maxIndex;
+        _accessibilityLabelGeneration = NSNotFound;
+        _accessibilityValueGeneration = NSNotFound;
     }
     return self;
 }
 
+- (NSString *)accessibilityLabel {
+    if (!_accessibilityLabelIsSet) {
+        id<SFLineGraphAccessibilityElementDataSource> dataSource = self.dataSource;
+        NSUInteger generation = [dataSource accessibilityStringGenerationForLineGraphAccessibilityElement:self];
+        if (generation != _accessibilityLabelGeneration) {
+            _accessibilityLabelGeneration = generation;
+            [super setAccessibilityLabel:[dataSource accessibilityLabelForLineGraphAccessibilityElement:self]];
+        }
+    }
+    return [super accessibilityLabel];
+}
+
+- (void)setAccessibilityLabel:(NSString *)accessibilityLabel {
+    _accessibilityLabelIsSet = YES;
+    [super setAccessibilityLabel:accessibilityLabel];
+}
+
+- (NSString *)accessibilityValue {
+    if (!_accessibilityValueIsSet) {
+        id<SFLineGraphAccessibilityElementDataSource> dataSource = self.dataSource;
+        NSUInteger generation = [dataSource accessibilityStringGenerationForLineGraphAccessibilityElement:self];
+        if (generation != _accessibilityValueGeneration) {
+            _accessibilityValueGeneration = generation;
+            [super setAccessibilityValue:[dataSource accessibilityValueForLineGraphAccessibilityElement:self]];
+        }
+    }
+    return [super accessibilityValue];
+}
+
+- (void)setAccessibilityValue:(NSString *)accessibilityValue {
+    _accessibilityValueIsSet = YES;
+    [super setAccessibilityValue:accessibilityValue];
+}
+
 - (CGRect)accessibilityFrame {
     if (self.maxIndex == 0) {
         return [super accessibilityFrame];
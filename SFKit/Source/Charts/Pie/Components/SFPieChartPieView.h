@@ -50,6 +50,8 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (CGFloat)normalizeValues;
 
+@property (nonatomic, readonly) NSInteger numberOfNormalizedValues;
+
 - (void)updatePieLayers;
 
 - (void)updatePercentageLabels;
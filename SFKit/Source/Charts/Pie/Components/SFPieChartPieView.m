@@ -36,10 +36,12 @@
 #import "SFPieChartView_Internal.h"
 
 #import "SFHelpers_Internal.h"
+#import "SFChartGeometry.h"
+#import "SFChartInstrumentation.h"
 
 
-static const CGFloat OriginAngle = -M_PI_2;
-static const CGFloat PercentageLabelOffset = 10.0;
+static const CGFloat OriginAngle = SFChartGeometryPieOriginAngle;
+static const CGFloat PercentageLabelOffset = SFChartGeometryPieLabelOffset;
 static const CGFloat InterAnimationDelay = 0.05;
 
 @implementation SFPieChartPieView {
@@ -112,6 +114,10 @@ static const CGFloat InterAnimationDelay = 0.05;
     return sumOfValues;
 }
 
+- (NSInteger)numberOfNormalizedValues {
+    return _normalizedValues.count;
+}
+
 #pragma mark - Layout and drawing
 
 - (void)layoutSubviews {
@@ -143,22 +149,38 @@ static const CGFloat InterAnimationDelay = 0.05;
     
     _circleLayer.path = circularArcBezierPath.CGPath;
     
+    id<SFChartPerformanceObserver> performanceObserver = _parentPieChartView.performanceObserver;
+    SFChartPhaseInterval interval = SFChartPhaseBegin(_parentPieChartView, SFChartPhaseLayout);
     [self layoutPieChartLayers];
     if (_parentPieChartView.showsPercentageLabels) {
         [self layoutPercentageLabelsWithRadius:innerRadius];
     }
+    SFChartPhaseEnd(_parentPieChartView, interval, _normalizedValues.count, performanceObserver);
 }
 
 - (void)updatePieLayers {
-    [_segmentLayers makeObjectsPerformSelector:@selector(removeFromSuperlayer)];
-    [_segmentLayers removeAllObjects];
-    
-    CGFloat cumulativeValue = 0;
     NSInteger numberOfSegments = [_parentPieChartView.dataSource numberOfSegmentsInPieChartView:_parentPieChartView];
-    for (NSInteger idx = 0; idx < numberOfSegments; idx++) {
-        
+    
+    // Reuse the existing segment layers, only adding or removing the difference
+    if (_segmentLayers.count > numberOfSegments) {
+        NSRange surplusRange = NSMakeRange(numberOfSegments, _segmentLayers.count - numberOfSegments);
+        [[_segmentLayers subarrayWithRange:surplusRange] makeObjectsPerformSelector:@selector(removeFromSuperlayer)];
+        [_segmentLayers removeObjectsInRange:surplusRange];
+    }
+    while (_segmentLayers.count < numberOfSegments) {
         CAShapeLayer *segmentLayer = [CAShapeLayer layer];
+        SFChartNoteAllocatedLayer();
         segmentLayer.fillColor = [[UIColor clearColor] CGColor];
+        [_circleLayer addSublayer:segmentLayer];
+        [_segmentLayers addObject:segmentLayer];
+    }
+    
+    // Reused segment layers are reconfigured without implicit animations
+    [CATransaction begin];
+    [CATransaction setDisableActions:YES];
+    CGFloat cumulativeValue = 0;
+    for (NSInteger idx = 0; idx < numberOfSegments; idx++) {
+        CAShapeLayer *segmentLayer = _segmentLayers[idx];
         segmentLayer.frame = _circleLayer.bounds;
         segmentLayer.path = _circleLayer.path;
         segmentLayer.lineWidth = _circleLayer.lineWidth;
@@ -166,49 +188,50 @@ static const CGFloat InterAnimationDelay = 0.05;
         CGFloat value = _normalizedValues[idx].floatValue;
         
         segmentLayer.strokeStart = cumulativeValue;
-        [_circleLayer addSublayer:segmentLayer];
-        [_segmentLayers addObject:segmentLayer];
         segmentLayer.strokeEnd = cumulativeValue + value;
 
         cumulativeValue += value;
     }
+    [CATransaction commit];
 }
 
 - (void)updatePercentageLabels {
-    for (SFPieChartSection *pieSection in _pieSections) {
-        [pieSection.label removeFromSuperview];
+    NSInteger numberOfLabels = 0;
+    if (_parentPieChartView.showsPercentageLabels) {
+        numberOfLabels = [_parentPieChartView.dataSource numberOfSegmentsInPieChartView:_parentPieChartView];
     }
-    [_pieSections removeAllObjects];
     
-    if (_parentPieChartView.showsPercentageLabels) {
-        CGFloat cumulativeValue = 0;
-        NSInteger numberOfSegments = [_parentPieChartView.dataSource numberOfSegmentsInPieChartView:_parentPieChartView];
-        for (NSInteger idx = 0; idx < numberOfSegments; idx++) {
-            CGFloat value = _normalizedValues[idx].floatValue;
-            
-            // Create a label
-            UILabel *label = [UILabel new];
-            label.text = [NSString stringWithFormat:@"%0.0f%%", value * 100];
-            label.font = _percentageLabelFont;
-            label.textColor = [_parentPieChartView colorForSegmentAtIndex:idx];
-            [label sizeToFit];
-            
-            // Only if there are no legends
-            label.isAccessibilityElement = ![_parentPieChartView.dataSource respondsToSelector:@selector(pieChartView:titleForSegmentAtIndex:)];
-            
-            // Calculate the angle to the centre of this segment in radians
-            CGFloat angle = 0;
-            if (_parentPieChartView.drawsClockwise) {
-                angle = (value / 2 + cumulativeValue) * M_PI * 2;
-            } else {
-                angle = (value / 2 + cumulativeValue) * - M_PI * 2;
-            }
-            
-            cumulativeValue += value;
-            SFPieChartSection *pieSection = [[SFPieChartSection alloc] initWithLabel:label angle:angle];
-            [_pieSections addObject:pieSection];
-            [self addSubview:label];
+    // Reuse the existing sections and their labels, only adding or removing the difference
+    if (_pieSections.count > numberOfLabels) {
+        NSRange surplusRange = NSMakeRange(numberOfLabels, _pieSections.count - numberOfLabels);
+        for (SFPieChartSection *pieSection in [_pieSections subarrayWithRange:surplusRange]) {
+            [pieSection.label removeFromSuperview];
         }
+        [_pieSections removeObjectsInRange:surplusRange];
+    }
+    while (_pieSections.count < numberOfLabels) {
+        UILabel *label = [UILabel new];
+        SFPieChartSection *pieSection = [[SFPieChartSection alloc] initWithLabel:label angle:0];
+        [_pieSections addObject:pieSection];
+        [self addSubview:label];
+    }
+    
+    BOOL labelsAreAccessibilityElements = ![_parentPieChartView.dataSource respondsToSelector:@selector(pieChartView:titleForSegmentAtIndex:)];
+    const double *angles = [self segmentAngleData].bytes;
+    for (NSInteger idx = 0; idx < numberOfLabels; idx++) {
+        CGFloat value = _normalizedValues[idx].floatValue;
+        
+        // Configure the label
+        SFPieChartSection *pieSection = _pieSections[idx];
+        UILabel *label = pieSection.label;
+        label.text = [NSString stringWithFormat:@"%0.0f%%", value * 100];
+        label.font = _percentageLabelFont;
+        label.textColor = [_parentPieChartView colorForSegmentAtIndex:idx];
+        [label sizeToFit];
+        
+        // Only if there are no legends
+        label.isAccessibilityElement = labelsAreAccessibilityElements;
+        pieSection.angle = angles[idx];
     }
 }
 
@@ -238,120 +261,48 @@ static const CGFloat InterAnimationDelay = 0.05;
 }
 
 - (void)layoutPercentageLabelsWithRadius:(CGFloat)pieRadius {
-    CGFloat cumulativeValue = 0;
-    NSInteger numberOfSegments = [_parentPieChartView.dataSource numberOfSegmentsInPieChartView:_parentPieChartView];
-    for (NSInteger idx = 0; idx < numberOfSegments; idx++) {
-        CGFloat value = _normalizedValues[idx].floatValue;
-
-        // Get a label
-        SFPieChartSection *pieSection = _pieSections[idx];
-        UILabel *label = pieSection.label;
-        
-        // Calculate the angle to the centre of this segment in radians
-        CGFloat angle = (value / 2 + cumulativeValue) * M_PI * 2;
-        if (!_parentPieChartView.drawsClockwise) {
-            angle = (value / 2 + cumulativeValue) * - M_PI * 2;
-        }
-        
-        label.center = [self percentageLabel:label calculateCenterForAngle:angle pieRadius:pieRadius];
-        cumulativeValue += value;
+    NSInteger numberOfSegments = MIN(_pieSections.count, _normalizedValues.count);
+    if (numberOfSegments == 0) {
+        return;
     }
-    [self adjustIntersectionsOfPercentageLabels:_pieSections pieRadius:pieRadius];
-}
-
-- (CGPoint)percentageLabel:(UILabel *)label calculateCenterForAngle:(CGFloat)angle pieRadius:(CGFloat)pieRadius {
-    // Calculate the desired distance from the circle's centre.
-    const CGFloat offset = 10;
-    CGFloat length = pieRadius + offset;
-    
-    // Calculate x and y coordinates for the point at this distance at the specified angle.
+    NSMutableData *angleData = [self segmentAngleData];
+    NSMutableData *centerData = [NSMutableData dataWithLength:numberOfSegments * sizeof(SFChartGeometryPoint)];
+    NSMutableData *labelSizeData = [NSMutableData dataWithLength:numberOfSegments * sizeof(SFChartGeometrySize)];
+    double *angles = angleData.mutableBytes;
+    SFChartGeometryPoint *centers = centerData.mutableBytes;
+    SFChartGeometrySize *labelSizes = labelSizeData.mutableBytes;
     CGSize size = self.bounds.size;
-    CGFloat cosine = cos(angle + OriginAngle);
-    CGFloat sine = sin(angle + OriginAngle);
-    CGFloat x = cosine * length + size.width / 2;
-    CGFloat y = sine *  length + size.height / 2;
-    
-    // Offset (x,y) to normalise the spacing from the circle's centre to the intersection with the label's frame rather than its centre.
-    CGSize labelSize = [label systemLayoutSizeFittingSize:UILayoutFittingCompressedSize];
-    CGFloat xIn = cosine * labelSize.width / 2;
-    CGFloat yIn = sine * labelSize.height / 2;
-    x += xIn;
-    y += yIn;
-    
-    return  CGPointMake(x, y);
-}
+    SFChartGeometrySize boundsSize = {size.width, size.height};
+    for (NSInteger idx = 0; idx < numberOfSegments; idx++) {
+        CGSize labelSize = [_pieSections[idx].label systemLayoutSizeFittingSize:UILayoutFittingCompressedSize];
+        labelSizes[idx] = (SFChartGeometrySize){labelSize.width, labelSize.height};
+        centers[idx] = SFChartGeometryPieLabelCenter(angles[idx], pieRadius, labelSizes[idx], boundsSize);
+    }
 
-- (void)adjustIntersectionsOfPercentageLabels:(NSArray<SFPieChartSection *> *)pieSections pieRadius:(CGFloat)pieRadius {
-    if (pieSections.count == 0) {
-        return;
+    // Overlapping labels are rotated apart from the angles they were given when they were last updated
+    for (NSInteger idx = 0; idx < numberOfSegments; idx++) {
+        angles[idx] = _pieSections[idx].angle;
     }
-    // Adjust labels while we have intersections
-    BOOL intersections = YES;
-    // We alternate directions in each iteration
-    BOOL shiftClockwise = NO;
-    CGFloat rotateDirection = _parentPieChartView.drawsClockwise ? 1 : -1;
-    // We use totalAngle to prevent from infinite loop
-    CGFloat totalAngle = 0;
-    while (intersections) {
-        intersections = NO;
-        shiftClockwise = !shiftClockwise;
-        
-        if (shiftClockwise) {
-            for (NSUInteger idx = 0; idx < (pieSections.count - 1); idx++) {
-                // Prevent from infinite loop
-                if (!idx) {
-                    totalAngle += 0.01;
-                    if (totalAngle >= 2 * M_PI) {
-                        return;
-                    }
-                }
-                SFPieChartSection *pieLabel  = pieSections[idx];
-                SFPieChartSection *nextPieLabel = pieSections[(idx + 1)];
-                if ([self shiftSectionLabel:nextPieLabel fromSectionLabel:pieLabel direction:rotateDirection pieRadius:pieRadius]) {
-                    intersections = YES;
-                }
-            }
-        } else {
-            for (NSInteger idx = pieSections.count - 1; idx > 0; idx--) {
-                SFPieChartSection *pieLabel = pieSections[idx];
-                SFPieChartSection *nextPieLabel = pieSections[idx - 1];
-                if ([self shiftSectionLabel:nextPieLabel fromSectionLabel:pieLabel direction:-rotateDirection pieRadius:pieRadius]) {
-                    intersections = YES;
-                }
-            }
-        }
-        
-        // Adjust space between last and first element
-        SFPieChartSection *firstPieLabel = pieSections.firstObject;
-        SFPieChartSection *lastPieLabel = pieSections.lastObject;
-        UILabel *firstLabel = firstPieLabel.label;
-        UILabel *lastLabel = lastPieLabel.label;
-        if (CGRectIntersectsRect(lastLabel.frame, firstLabel.frame)) {
-            CGFloat firstLabelAngle = firstPieLabel.angle;
-            CGFloat lastLabelAngle = lastPieLabel.angle;
-            firstLabelAngle += rotateDirection * 0.01;
-            lastLabelAngle -= rotateDirection * 0.01;
-            firstPieLabel.angle = firstLabelAngle;
-            lastPieLabel.angle = lastLabelAngle;
-        }
+    SFChartGeometryResolvePieLabelIntersections(angles, centers, labelSizes, numberOfSegments, pieRadius, boundsSize,
+                                                _parentPieChartView.drawsClockwise);
+    for (NSInteger idx = 0; idx < numberOfSegments; idx++) {
+        SFPieChartSection *pieSection = _pieSections[idx];
+        pieSection.angle = angles[idx];
+        pieSection.label.center = CGPointMake(centers[idx].x, centers[idx].y);
     }
 }
 
-- (BOOL)shiftSectionLabel:(SFPieChartSection *)nextPieSection
-         fromSectionLabel:(SFPieChartSection *)fromPieSection
-                direction:(CGFloat)direction
-                pieRadius:(CGFloat)pieRadius {
-    CGFloat shiftStep = 0.01;
-    UILabel *label = fromPieSection.label;
-    UILabel *nextLabel = nextPieSection.label;
-    if (CGRectIntersectsRect(label.frame, nextLabel.frame)) {
-        CGFloat nextLabelAngle = nextPieSection.angle;
-        nextLabelAngle += direction * shiftStep;
-        nextPieSection.angle = nextLabelAngle;
-        nextLabel.center = [self percentageLabel:nextLabel calculateCenterForAngle:nextLabelAngle pieRadius:pieRadius];
-        return YES;
+// The angle to the centre of each segment in radians
+- (NSMutableData *)segmentAngleData {
+    NSInteger numberOfSegments = _normalizedValues.count;
+    NSMutableData *normalizedValueData = [NSMutableData dataWithLength:MAX(numberOfSegments, 1) * sizeof(double)];
+    NSMutableData *angleData = [NSMutableData dataWithLength:MAX(numberOfSegments, 1) * sizeof(double)];
+    double *normalizedValues = normalizedValueData.mutableBytes;
+    for (NSInteger idx = 0; idx < numberOfSegments; idx++) {
+        normalizedValues[idx] = _normalizedValues[idx].doubleValue;
     }
-    return NO;
+    SFChartGeometryPieSegmentAngles(normalizedValues, angleData.mutableBytes, numberOfSegments, _parentPieChartView.drawsClockwise);
+    return angleData;
 }
 
 - (void)animateWithDuration:(NSTimeInterval)animationDuration {
@@ -33,6 +33,7 @@
 
 @import UIKit;
 #import <SFKit/SFDefines.h>
+#import <SFKit/SFChartPerformanceObserver.h>
 
 
 NS_ASSUME_NONNULL_BEGIN
@@ -119,6 +120,13 @@ IB_DESIGNABLE
 */
 @property (nonatomic, weak, nullable) id <SFPieChartViewDataSource> dataSource;
 
+/**
+ The object told how long each phase of reloading and laying out the pie chart took.
+
+ See the `SFChartPerformanceObserver` protocol.
+ */
+@property (nonatomic, weak, nullable) id <SFChartPerformanceObserver> performanceObserver;
+
 /**
  The width of the line used to draw the circular sections of the pie chart.
  
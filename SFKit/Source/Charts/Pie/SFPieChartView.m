@@ -39,6 +39,7 @@
 #import "SFPieChartTitleTextView.h"
 
 #import "SFHelpers_Internal.h"
+#import "SFChartInstrumentation.h"
 #import "SFSkin.h"
 
 
@@ -185,11 +186,17 @@ static const CGFloat PieToLegendPadding = 8.0;
 }
 
 - (void)reloadData {
+    SFChartPhaseInterval interval = SFChartPhaseBegin(self, SFChartPhaseDataSource);
     CGFloat sumOfValues = [_pieView normalizeValues];
+    NSInteger numberOfSegments = _pieView.numberOfNormalizedValues;
+    SFChartPhaseEnd(self, interval, numberOfSegments, _performanceObserver);
+    
+    interval = SFChartPhaseBegin(self, SFChartPhaseLayerUpdate);
     [_pieView updatePieLayers];
     [_pieView updatePercentageLabels];
     [_titleTextView showNoDataLabel:(sumOfValues == 0)];
     [self updateLegendView];
+    SFChartPhaseEnd(self, interval, numberOfSegments, _performanceObserver);
 }
 
 - (void)setDataSource:(id<SFPieChartViewDataSource>)dataSource {
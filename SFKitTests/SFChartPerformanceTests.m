@@ -0,0 +1,370 @@
+//
+//  SFChartPerformanceTests.m
+//  SFKitTests
+//
+//  Created by David Moore on 10/17/26.
+//  Copyright © 2026 Moore Development. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import <SFKit/SFKit.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+// Scrubbing internals, driven directly since touches cannot be delivered programmatically
+@interface SFGraphChartView (SFChartPerformanceTests)
+
+- (void)handleScrubbingGesture:(UIGestureRecognizer *)gestureRecognizer;
+
+- (void)scrubberDisplayLinkDidFire:(nullable CADisplayLink *)displayLink;
+
+@end
+
+// A pan gesture recognizer whose state and location are set by the test
+@interface SFChartPerformanceScrubbingGestureRecognizer : UIPanGestureRecognizer
+
+@property (nonatomic) UIGestureRecognizerState scrubbingState;
+
+@property (nonatomic) CGPoint location;
+
+@end
+
+/**
+ Deterministic data source for every chart type. Values follow a sum of sines of the point index, and
+ every 97th point is unset, so each run charts exactly the same data.
+ */
+@interface SFChartPerformanceDataSource : NSObject <SFValueRangeGraphChartViewDataSource, SFValueStackGraphChartViewDataSource, SFPieChartViewDataSource>
+
+- (instancetype)init NS_UNAVAILABLE;
++ (instancetype)new NS_UNAVAILABLE;
+
+- (instancetype)initWithNumberOfPoints:(NSInteger)numberOfPoints numberOfPlots:(NSInteger)numberOfPlots NS_DESIGNATED_INITIALIZER;
+
+@property (nonatomic, readonly) NSInteger numberOfPoints;
+
+@property (nonatomic, readonly) NSInteger numberOfPlots;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+static const CGRect SFChartPerformanceFrame = {{0, 0}, {375, 300}};
+
+static const CGRect SFChartPerformanceResizedFrame = {{0, 0}, {667, 300}};
+
+static double SFChartPerformanceValue(NSInteger pointIndex, NSInteger plotIndex) {
+    return 50 + 30 * sin(pointIndex * 0.01 + plotIndex) + 10 * sin(pointIndex * 0.37);
+}
+
+@implementation SFChartPerformanceScrubbingGestureRecognizer
+
+- (UIGestureRecognizerState)state {
+    return _scrubbingState;
+}
+
+- (CGPoint)locationInView:(UIView *)view {
+    return _location;
+}
+
+@end
+
+
+@implementation SFChartPerformanceDataSource
+
+- (instancetype)initWithNumberOfPoints:(NSInteger)numberOfPoints numberOfPlots:(NSInteger)numberOfPlots {
+    if (self = [super init]) {
+        _numberOfPoints = numberOfPoints;
+        _numberOfPlots = numberOfPlots;
+    }
+    return self;
+}
+
+#pragma mark - Graph Chart View Data Source
+
+- (NSInteger)numberOfPlotsInGraphChartView:(SFGraphChartView *)graphChartView {
+    return _numberOfPlots;
+}
+
+- (NSInteger)graphChartView:(SFGraphChartView *)graphChartView numberOfDataPointsForPlotIndex:(NSInteger)plotIndex {
+    return _numberOfPoints;
+}
+
+- (id)graphChartView:(SFGraphChartView *)graphChartView dataPointForPointIndex:(NSInteger)pointIndex plotIndex:(NSInteger)plotIndex {
+    double value = SFChartPerformanceValue(pointIndex, plotIndex);
+    if ([graphChartView isKindOfClass:[SFBarGraphChartView class]]) {
+        return [[SFValueStack alloc] initWithStackedValues:@[@(value / 2), @(value / 2)]];
+    }
+    if (pointIndex % 97 == 96) {
+        return [SFValueRange new];
+    }
+    return [[SFValueRange alloc] initWithValue:value];
+}
+
+- (void)graphChartView:(SFGraphChartView *)graphChartView getMinimumValues:(double *)minimumValues maximumValues:(double *)maximumValues range:(NSRange)range plotIndex:(NSInteger)plotIndex {
+    for (NSUInteger index = 0; index < range.length; index++) {
+        NSInteger pointIndex = range.location + index;
+        double value = (pointIndex % 97 == 96) ? SFDoubleInvalidValue : SFChartPerformanceValue(pointIndex, plotIndex);
+        minimumValues[index] = value;
+        maximumValues[index] = value;
+    }
+}
+
+#pragma mark - Pie Chart View Data Source
+
+- (NSInteger)numberOfSegmentsInPieChartView:(SFPieChartView *)pieChartView {
+    return _numberOfPoints;
+}
+
+- (CGFloat)pieChartView:(SFPieChartView *)pieChartView valueForSegmentAtIndex:(NSInteger)index {
+    // Alternating wide and narrow segments crowd the percentage labels
+    return (index % 4 == 0) ? 20 : 1 + SFChartPerformanceValue(index, 0) / 100;
+}
+
+@end
+
+
+@interface SFChartPerformanceTests : XCTestCase
+
+@end
+
+@implementation SFChartPerformanceTests
+
+#pragma mark - Helpers
+
+- (void)measureReloadDataOfGraphChartViewClass:(Class)graphChartViewClass numberOfPoints:(NSInteger)numberOfPoints {
+    SFChartPerformanceDataSource *dataSource = [[SFChartPerformanceDataSource alloc] initWithNumberOfPoints:numberOfPoints numberOfPlots:2];
+    SFGraphChartView *graphChartView = [[graphChartViewClass alloc] initWithFrame:SFChartPerformanceFrame];
+    graphChartView.dataSource = dataSource;
+    [graphChartView layoutIfNeeded];
+
+    [self measureBlock:^{
+        [graphChartView reloadData];
+        [graphChartView layoutIfNeeded];
+    }];
+}
+
+- (void)measureLayoutOfGraphChartViewClass:(Class)graphChartViewClass numberOfPoints:(NSInteger)numberOfPoints {
+    SFChartPerformanceDataSource *dataSource = [[SFChartPerformanceDataSource alloc] initWithNumberOfPoints:numberOfPoints numberOfPlots:2];
+    SFGraphChartView *graphChartView = [[graphChartViewClass alloc] initWithFrame:SFChartPerformanceFrame];
+    graphChartView.dataSource = dataSource;
+    [graphChartView layoutIfNeeded];
+
+    // Alternating sizes keep every pass from hitting the unchanged layout
+    __block BOOL resized = NO;
+    [self measureBlock:^{
+        resized = !resized;
+        graphChartView.frame = resized ? SFChartPerformanceResizedFrame : SFChartPerformanceFrame;
+        [graphChartView layoutIfNeeded];
+    }];
+}
+
+- (void)measureScrubbingOfLineGraphChartViewWithNumberOfPoints:(NSInteger)numberOfPoints {
+    SFChartPerformanceDataSource *dataSource = [[SFChartPerformanceDataSource alloc] initWithNumberOfPoints:numberOfPoints numberOfPlots:2];
+    SFLineGraphChartView *lineGraphChartView = [[SFLineGraphChartView alloc] initWithFrame:SFChartPerformanceFrame];
+    lineGraphChartView.dataSource = dataSource;
+    [lineGraphChartView layoutIfNeeded];
+
+    // One sweep across the chart, a touch per point of width. Touches are delivered twice per display
+    // frame, as on displays sampling touches at twice their refresh rate, so the updates are coalesced
+    // by the display link as they are while scrubbing
+    SFChartPerformanceScrubbingGestureRecognizer *gestureRecognizer = [SFChartPerformanceScrubbingGestureRecognizer new];
+    CGFloat width = CGRectGetWidth(SFChartPerformanceFrame);
+    [self measureBlock:^{
+        gestureRecognizer.location = CGPointZero;
+        gestureRecognizer.scrubbingState = UIGestureRecognizerStateBegan;
+        [lineGraphChartView handleScrubbingGesture:gestureRecognizer];
+        gestureRecognizer.scrubbingState = UIGestureRecognizerStateChanged;
+        for (CGFloat xPosition = 1; xPosition < width; xPosition++) {
+            gestureRecognizer.location = CGPointMake(xPosition, 0);
+            [lineGraphChartView handleScrubbingGesture:gestureRecognizer];
+            if ((NSInteger)xPosition % 2 == 0) {
+                [lineGraphChartView scrubberDisplayLinkDidFire:nil];
+            }
+        }
+        gestureRecognizer.scrubbingState = UIGestureRecognizerStateEnded;
+        [lineGraphChartView handleScrubbingGesture:gestureRecognizer];
+    }];
+}
+
+- (void)measureReloadDataOfPieChartViewWithNumberOfSegments:(NSInteger)numberOfSegments {
+    SFChartPerformanceDataSource *dataSource = [[SFChartPerformanceDataSource alloc] initWithNumberOfPoints:numberOfSegments numberOfPlots:1];
+    SFPieChartView *pieChartView = [[SFPieChartView alloc] initWithFrame:SFChartPerformanceFrame];
+    pieChartView.dataSource = dataSource;
+    [pieChartView layoutIfNeeded];
+
+    [self measureBlock:^{
+        [pieChartView reloadData];
+    }];
+}
+
+- (void)measureLayoutOfPieChartViewWithNumberOfSegments:(NSInteger)numberOfSegments {
+    SFChartPerformanceDataSource *dataSource = [[SFChartPerformanceDataSource alloc] initWithNumberOfPoints:numberOfSegments numberOfPlots:1];
+    SFPieChartView *pieChartView = [[SFPieChartView alloc] initWithFrame:SFChartPerformanceFrame];
+    pieChartView.showsPercentageLabels = YES;
+    pieChartView.dataSource = dataSource;
+    [pieChartView layoutIfNeeded];
+
+    [self measureBlock:^{
+        [pieChartView reloadData];
+        [pieChartView layoutIfNeeded];
+    }];
+}
+
+#pragma mark - Line Graph Chart View
+
+- (void)testLineGraphChartViewReloadData100Points {
+    [self measureReloadDataOfGraphChartViewClass:[SFLineGraphChartView class] numberOfPoints:100];
+}
+
+- (void)testLineGraphChartViewReloadData10kPoints {
+    [self measureReloadDataOfGraphChartViewClass:[SFLineGraphChartView class] numberOfPoints:10000];
+}
+
+- (void)testLineGraphChartViewReloadData100kPoints {
+    [self measureReloadDataOfGraphChartViewClass:[SFLineGraphChartView class] numberOfPoints:100000];
+}
+
+- (void)testLineGraphChartViewReloadData1MPoints {
+    [self measureReloadDataOfGraphChartViewClass:[SFLineGraphChartView class] numberOfPoints:1000000];
+}
+
+- (void)testLineGraphChartViewLayout100Points {
+    [self measureLayoutOfGraphChartViewClass:[SFLineGraphChartView class] numberOfPoints:100];
+}
+
+- (void)testLineGraphChartViewLayout10kPoints {
+    [self measureLayoutOfGraphChartViewClass:[SFLineGraphChartView class] numberOfPoints:10000];
+}
+
+- (void)testLineGraphChartViewLayout100kPoints {
+    [self measureLayoutOfGraphChartViewClass:[SFLineGraphChartView class] numberOfPoints:100000];
+}
+
+- (void)testLineGraphChartViewLayout1MPoints {
+    [self measureLayoutOfGraphChartViewClass:[SFLineGraphChartView class] numberOfPoints:1000000];
+}
+
+- (void)testLineGraphChartViewScrubbing10kPoints {
+    [self measureScrubbingOfLineGraphChartViewWithNumberOfPoints:10000];
+}
+
+- (void)testLineGraphChartViewScrubbing1MPoints {
+    [self measureScrubbingOfLineGraphChartViewWithNumberOfPoints:1000000];
+}
+
+#pragma mark - Discrete Graph Chart View
+
+- (void)testDiscreteGraphChartViewReloadData100Points {
+    [self measureReloadDataOfGraphChartViewClass:[SFDiscreteGraphChartView class] numberOfPoints:100];
+}
+
+- (void)testDiscreteGraphChartViewReloadData10kPoints {
+    [self measureReloadDataOfGraphChartViewClass:[SFDiscreteGraphChartView class] numberOfPoints:10000];
+}
+
+- (void)testDiscreteGraphChartViewReloadData100kPoints {
+    [self measureReloadDataOfGraphChartViewClass:[SFDiscreteGraphChartView class] numberOfPoints:100000];
+}
+
+- (void)testDiscreteGraphChartViewReloadData1MPoints {
+    [self measureReloadDataOfGraphChartViewClass:[SFDiscreteGraphChartView class] numberOfPoints:1000000];
+}
+
+- (void)testDiscreteGraphChartViewLayout100Points {
+    [self measureLayoutOfGraphChartViewClass:[SFDiscreteGraphChartView class] numberOfPoints:100];
+}
+
+- (void)testDiscreteGraphChartViewLayout10kPoints {
+    [self measureLayoutOfGraphChartViewClass:[SFDiscreteGraphChartView class] numberOfPoints:10000];
+}
+
+- (void)testDiscreteGraphChartViewLayout100kPoints {
+    [self measureLayoutOfGraphChartViewClass:[SFDiscreteGraphChartView class] numberOfPoints:100000];
+}
+
+- (void)testDiscreteGraphChartViewLayout1MPoints {
+    [self measureLayoutOfGraphChartViewClass:[SFDiscreteGraphChartView class] numberOfPoints:1000000];
+}
+
+#pragma mark - Bar Graph Chart View
+
+- (void)testBarGraphChartViewReloadData100Points {
+    [self measureReloadDataOfGraphChartViewClass:[SFBarGraphChartView class] numberOfPoints:100];
+}
+
+- (void)testBarGraphChartViewReloadData10kPoints {
+    [self measureReloadDataOfGraphChartViewClass:[SFBarGraphChartView class] numberOfPoints:10000];
+}
+
+- (void)testBarGraphChartViewReloadData100kPoints {
+    [self measureReloadDataOfGraphChartViewClass:[SFBarGraphChartView class] numberOfPoints:100000];
+}
+
+- (void)testBarGraphChartViewReloadData1MPoints {
+    [self measureReloadDataOfGraphChartViewClass:[SFBarGraphChartView class] numberOfPoints:1000000];
+}
+
+- (void)testBarGraphChartViewLayout100Points {
+    [self measureLayoutOfGraphChartViewClass:[SFBarGraphChartView class] numberOfPoints:100];
+}
+
+- (void)testBarGraphChartViewLayout10kPoints {
+    [self measureLayoutOfGraphChartViewClass:[SFBarGraphChartView class] numberOfPoints:10000];
+}
+
+- (void)testBarGraphChartViewLayout100kPoints {
+    [self measureLayoutOfGraphChartViewClass:[SFBarGraphChartView class] numberOfPoints:100000];
+}
+
+- (void)testBarGraphChartViewLayout1MPoints {
+    [self measureLayoutOfGraphChartViewClass:[SFBarGraphChartView class] numberOfPoints:1000000];
+}
+
+#pragma mark - Pie Chart View
+
+- (void)testPieChartViewReloadData100Segments {
+    [self measureReloadDataOfPieChartViewWithNumberOfSegments:100];
+}
+
+- (void)testPieChartViewReloadData10kSegments {
+    [self measureReloadDataOfPieChartViewWithNumberOfSegments:10000];
+}
+
+- (void)testPieChartViewReloadData100kSegments {
+    [self measureReloadDataOfPieChartViewWithNumberOfSegments:100000];
+}
+
+- (void)testPieChartViewReloadData1MSegments {
+    [self measureReloadDataOfPieChartViewWithNumberOfSegments:1000000];
+}
+
+- (void)testPieChartViewLayout5Segments {
+    [self measureLayoutOfPieChartViewWithNumberOfSegments:5];
+}
+
+- (void)testPieChartViewLayout50Segments {
+    [self measureLayoutOfPieChartViewWithNumberOfSegments:50];
+}
+
+- (void)testPieChartViewLayout200Segments {
+    [self measureLayoutOfPieChartViewWithNumberOfSegments:200];
+}
+
+#pragma mark - Appearance
+
+- (void)testAppearanceStyleChangeWith10kEnvironments {
+    SFAppearance *appearance = [[SFAppearance alloc] initWithStyle:SFAppearanceStyleLight];
+    NSMutableArray<UIView *> *views = [NSMutableArray arrayWithCapacity:10000];
+    for (NSInteger index = 0; index < 10000; index++) {
+        UIView *view = [UIView new];
+        [appearance addAppearanceEnvironment:view];
+        [views addObject:view];
+    }
+
+    [self measureBlock:^{
+        appearance.style = SFAppearanceStyleDark;
+        appearance.style = SFAppearanceStyleLight;
+    }];
+}
+
+@end